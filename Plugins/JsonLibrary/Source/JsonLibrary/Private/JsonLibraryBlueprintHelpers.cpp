@@ -2,6 +2,17 @@
 #include "JsonLibraryBlueprintHelpers.h"
 #include "Engine/UserDefinedStruct.h"
 
+// Shared by every copy of an iterator, so the loop can advance it through a plain input.
+struct FJsonLibraryIteratorState
+{
+	FJsonLibraryList List;
+	FJsonLibraryObject Object;
+	// Keys are taken when the loop starts, so the loop body may add or remove properties.
+	TOptional<TArray<FString>> Keys;
+	int32 Key = INDEX_NONE;
+	int32 Index = INDEX_NONE;
+};
+
 bool UJsonLibraryBlueprintHelpers::StructFromJson( const UScriptStruct* StructType, const FJsonLibraryObject& Object, FStructBase& OutStruct )
 {
 	check( 0 );
@@ -33,6 +44,21 @@ bool UJsonLibraryBlueprintHelpers::Generic_StructToJson( const UScriptStruct* St
 	return OutObject.IsValid();
 }
 
+bool UJsonLibraryBlueprintHelpers::StructFromJsonSchema( const FJsonLibrarySchema& Schema, const FString& Text, FStructBase& OutStruct, FString& Error )
+{
+	check( 0 );
+	return false;
+}
+
+bool UJsonLibraryBlueprintHelpers::Generic_StructFromJsonSchema( const FJsonLibrarySchema& Schema, const FString& Text, const UScriptStruct* StructType, void* OutStructPtr, FString& Error )
+{
+	Error.Empty();
+	if ( !StructType || !OutStructPtr )
+		return false;
+
+	return Schema.Decode( Text, StructType, OutStructPtr, &Error );
+}
+
 FJsonLibraryObject UJsonLibraryBlueprintHelpers::ConstructInvalidObject()
 {
 	return FJsonLibraryObject( TSharedPtr<FJsonValueObject>() );
@@ -43,6 +69,58 @@ bool UJsonLibraryBlueprintHelpers::IsValidObject( const FJsonLibraryObject& Obje
 	return Object.IsValid();
 }
 
+FJsonLibraryIterator UJsonLibraryBlueprintHelpers::IterateList( const FJsonLibraryList& Target )
+{
+	FJsonLibraryIterator Iterator;
+	Iterator.State = MakeShareable( new FJsonLibraryIteratorState() );
+	Iterator.State->List = Target;
+
+	return Iterator;
+}
+
+FJsonLibraryIterator UJsonLibraryBlueprintHelpers::IterateObject( const FJsonLibraryObject& Target )
+{
+	FJsonLibraryIterator Iterator;
+	Iterator.State = MakeShareable( new FJsonLibraryIteratorState() );
+	Iterator.State->Object = Target;
+	Iterator.State->Keys.Emplace( Target.GetKeys() );
+
+	return Iterator;
+}
+
+bool UJsonLibraryBlueprintHelpers::IteratorNext( const FJsonLibraryIterator& Iterator, int32& Index, FString& Key, FJsonLibraryValue& Value )
+{
+	FJsonLibraryIteratorState* State = Iterator.State.Get();
+	if ( !State )
+		return false;
+
+	if ( State->Keys.IsSet() )
+	{
+		// properties removed by the loop body are skipped
+		const TArray<FString>& Keys = State->Keys.GetValue();
+		while ( ++State->Key < Keys.Num() )
+		{
+			if ( !State->Object.HasKey( Keys[ State->Key ] ) )
+				continue;
+
+			Index = ++State->Index;
+			Key = Keys[ State->Key ];
+			Value = State->Object.GetValue( Key );
+			return true;
+		}
+
+		return false;
+	}
+
+	if ( State->Index + 1 >= State->List.Count() )
+		return false;
+
+	Index = ++State->Index;
+	Key.Empty();
+	Value = State->List.GetValue( Index );
+	return true;
+}
+
 bool UJsonLibraryBlueprintHelpers::InitializeStructData( const FJsonLibraryObject& Object, const UScriptStruct* StructType, FStructOnScope& StructData )
 {
 	if ( !StructType )
@@ -0,0 +1,906 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibraryCbor.h"
+#include "Dom/JsonObject.h"
+#include "Misc/Base64.h"
+#include <math.h>
+
+namespace JsonLibraryCbor
+{
+	// Major types.
+	static constexpr uint8 MajorUnsigned = 0;
+	static constexpr uint8 MajorNegative = 1;
+	static constexpr uint8 MajorBytes    = 2;
+	static constexpr uint8 MajorText     = 3;
+	static constexpr uint8 MajorArray    = 4;
+	static constexpr uint8 MajorMap      = 5;
+	static constexpr uint8 MajorTag      = 6;
+	static constexpr uint8 MajorSimple   = 7;
+
+	// Additional information.
+	static constexpr uint8 AdditionalFalse      = 20;
+	static constexpr uint8 AdditionalTrue       = 21;
+	static constexpr uint8 AdditionalNull       = 22;
+	static constexpr uint8 AdditionalHalf       = 25;
+	static constexpr uint8 AdditionalFloat      = 26;
+	static constexpr uint8 AdditionalDouble     = 27;
+	static constexpr uint8 AdditionalIndefinite = 31;
+
+	static constexpr uint8 Break = 0xFF;
+
+	// Typed array tags (RFC 8746).
+	static constexpr uint8 TagTypedFirst   = 64;
+	static constexpr uint8 TagTypedLast    = 87;
+	static constexpr uint8 TagFloat32      = PLATFORM_LITTLE_ENDIAN ? 85 : 81;
+	static constexpr uint8 TagFloat64      = PLATFORM_LITTLE_ENDIAN ? 86 : 82;
+
+	// Lists shorter than this are written as plain arrays.
+	static constexpr int32 MinTypedArray = 4;
+	// Deepest nesting accepted when reading.
+	static constexpr int32 MaxDepth = 1024;
+
+	static bool IsInteger( double Value )
+	{
+		return FMath::IsFinite( Value )
+			&& Value == FMath::FloorToDouble( Value )
+			&& Value >= -9223372036854775808.0
+			&& Value < 9223372036854775808.0;
+	}
+
+	static double HalfToDouble( uint16 Half )
+	{
+		const int32 Exponent = ( Half >> 10 ) & 0x1F;
+		const int32 Mantissa = Half & 0x3FF;
+
+		double Value;
+		if ( Exponent == 0 )
+			Value = ldexp( (double)Mantissa, -24 );
+		else if ( Exponent != 31 )
+			Value = ldexp( (double)( Mantissa + 1024 ), Exponent - 25 );
+		else
+			Value = Mantissa == 0 ? HUGE_VAL : NAN;
+
+		return ( Half & 0x8000 ) ? -Value : Value;
+	}
+}
+
+FJsonLibraryCborWriter::FJsonLibraryCborWriter( TArray<uint8>& InData, bool bInTypedArrays /*= true*/ )
+	: Data( InData )
+	, bTypedArrays( bInTypedArrays )
+{
+}
+
+void FJsonLibraryCborWriter::WriteIdentifier( const FString& Identifier )
+{
+	WriteString( *Identifier, Identifier.Len() );
+}
+
+void FJsonLibraryCborWriter::WriteObjectStart()
+{
+	Data.Add( (uint8)( ( JsonLibraryCbor::MajorMap << 5 ) | JsonLibraryCbor::AdditionalIndefinite ) );
+}
+
+void FJsonLibraryCborWriter::WriteObjectStart( const FString& Identifier )
+{
+	WriteIdentifier( Identifier );
+	WriteObjectStart();
+}
+
+void FJsonLibraryCborWriter::WriteObjectEnd()
+{
+	Data.Add( JsonLibraryCbor::Break );
+}
+
+void FJsonLibraryCborWriter::WriteArrayStart()
+{
+	Data.Add( (uint8)( ( JsonLibraryCbor::MajorArray << 5 ) | JsonLibraryCbor::AdditionalIndefinite ) );
+}
+
+void FJsonLibraryCborWriter::WriteArrayStart( const FString& Identifier )
+{
+	WriteIdentifier( Identifier );
+	WriteArrayStart();
+}
+
+void FJsonLibraryCborWriter::WriteArrayEnd()
+{
+	Data.Add( JsonLibraryCbor::Break );
+}
+
+void FJsonLibraryCborWriter::WriteNull()
+{
+	Data.Add( (uint8)( ( JsonLibraryCbor::MajorSimple << 5 ) | JsonLibraryCbor::AdditionalNull ) );
+}
+
+void FJsonLibraryCborWriter::WriteNull( const FString& Identifier )
+{
+	WriteIdentifier( Identifier );
+	WriteNull();
+}
+
+void FJsonLibraryCborWriter::WriteValue( bool Value )
+{
+	Data.Add( (uint8)( ( JsonLibraryCbor::MajorSimple << 5 ) | ( Value ? JsonLibraryCbor::AdditionalTrue : JsonLibraryCbor::AdditionalFalse ) ) );
+}
+
+void FJsonLibraryCborWriter::WriteValue( float Value )
+{
+	WriteValue( (double)Value );
+}
+
+void FJsonLibraryCborWriter::WriteValue( double Value )
+{
+	// use the smallest encoding that reads back as the same number
+	if ( JsonLibraryCbor::IsInteger( Value ) )
+		WriteInteger( (int64)Value );
+	else if ( (double)(float)Value == Value || !FMath::IsFinite( Value ) )
+		WriteFloat32( (float)Value );
+	else
+		WriteFloat64( Value );
+}
+
+void FJsonLibraryCborWriter::WriteValue( int32 Value )
+{
+	WriteInteger( Value );
+}
+
+void FJsonLibraryCborWriter::WriteValue( int64 Value )
+{
+	WriteInteger( Value );
+}
+
+void FJsonLibraryCborWriter::WriteValue( const FString& Value )
+{
+	WriteString( *Value, Value.Len() );
+}
+
+void FJsonLibraryCborWriter::WriteValue( const TCHAR* Value )
+{
+	WriteString( Value, FCString::Strlen( Value ) );
+}
+
+void FJsonLibraryCborWriter::WriteValue( const TSharedPtr<FJsonValue>& Value )
+{
+	if ( !Value.IsValid() )
+	{
+		WriteNull();
+		return;
+	}
+
+	switch ( Value->Type )
+	{
+	case EJson::Boolean:
+		WriteValue( Value->AsBool() );
+		break;
+	case EJson::Number:
+		WriteValue( Value->AsNumber() );
+		break;
+	case EJson::String:
+		WriteValue( Value->AsString() );
+		break;
+	case EJson::Array:
+		WriteJsonArray( Value->AsArray() );
+		break;
+	case EJson::Object:
+	{
+		const TSharedPtr<FJsonObject>& Object = Value->AsObject();
+		if ( !Object.IsValid() )
+		{
+			WriteNull();
+			break;
+		}
+
+		WriteHead( JsonLibraryCbor::MajorMap, Object->Values.Num() );
+		for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : Object->Values )
+		{
+			WriteIdentifier( Temp.Key );
+			WriteValue( Temp.Value );
+		}
+		break;
+	}
+	default:
+		WriteNull();
+		break;
+	}
+}
+
+void FJsonLibraryCborWriter::WriteFloatArray( const float* Values, int32 Num )
+{
+	if ( bTypedArrays )
+	{
+		WriteTypedArray( JsonLibraryCbor::TagFloat32, Values, Num, sizeof( float ) );
+		return;
+	}
+
+	WriteHead( JsonLibraryCbor::MajorArray, Num );
+	for ( int32 i = 0; i < Num; i++ )
+		WriteValue( Values[ i ] );
+}
+
+void FJsonLibraryCborWriter::WriteFloatArray( const FString& Identifier, const TArray<float>& Values )
+{
+	WriteIdentifier( Identifier );
+	WriteFloatArray( Values.GetData(), Values.Num() );
+}
+
+void FJsonLibraryCborWriter::WriteNumberArray( const double* Values, int32 Num )
+{
+	if ( bTypedArrays )
+	{
+		WriteTypedArray( JsonLibraryCbor::TagFloat64, Values, Num, sizeof( double ) );
+		return;
+	}
+
+	WriteHead( JsonLibraryCbor::MajorArray, Num );
+	for ( int32 i = 0; i < Num; i++ )
+		WriteValue( Values[ i ] );
+}
+
+void FJsonLibraryCborWriter::WriteNumberArray( const FString& Identifier, const TArray<double>& Values )
+{
+	WriteIdentifier( Identifier );
+	WriteNumberArray( Values.GetData(), Values.Num() );
+}
+
+void FJsonLibraryCborWriter::WriteHead( uint8 Major, uint64 Value )
+{
+	Major <<= 5;
+	if ( Value < 24 )
+	{
+		Data.Add( (uint8)( Major | Value ) );
+		return;
+	}
+
+	int32 Bytes;
+	if ( Value <= 0xFF )
+	{
+		Data.Add( (uint8)( Major | 24 ) );
+		Bytes = 1;
+	}
+	else if ( Value <= 0xFFFF )
+	{
+		Data.Add( (uint8)( Major | 25 ) );
+		Bytes = 2;
+	}
+	else if ( Value <= 0xFFFFFFFF )
+	{
+		Data.Add( (uint8)( Major | 26 ) );
+		Bytes = 4;
+	}
+	else
+	{
+		Data.Add( (uint8)( Major | 27 ) );
+		Bytes = 8;
+	}
+
+	const int32 Index = Data.AddUninitialized( Bytes );
+	for ( int32 i = Bytes - 1; i >= 0; i-- )
+	{
+		Data[ Index + i ] = (uint8)Value;
+		Value >>= 8;
+	}
+}
+
+void FJsonLibraryCborWriter::WriteInteger( int64 Value )
+{
+	if ( Value >= 0 )
+		WriteHead( JsonLibraryCbor::MajorUnsigned, (uint64)Value );
+	else
+		WriteHead( JsonLibraryCbor::MajorNegative, (uint64)( -1 - Value ) );
+}
+
+void FJsonLibraryCborWriter::WriteFloat32( float Value )
+{
+	uint32 Bits;
+	FMemory::Memcpy( &Bits, &Value, sizeof( Bits ) );
+
+	Data.Add( (uint8)( ( JsonLibraryCbor::MajorSimple << 5 ) | JsonLibraryCbor::AdditionalFloat ) );
+	const int32 Index = Data.AddUninitialized( 4 );
+	for ( int32 i = 3; i >= 0; i-- )
+	{
+		Data[ Index + i ] = (uint8)Bits;
+		Bits >>= 8;
+	}
+}
+
+void FJsonLibraryCborWriter::WriteFloat64( double Value )
+{
+	uint64 Bits;
+	FMemory::Memcpy( &Bits, &Value, sizeof( Bits ) );
+
+	Data.Add( (uint8)( ( JsonLibraryCbor::MajorSimple << 5 ) | JsonLibraryCbor::AdditionalDouble ) );
+	const int32 Index = Data.AddUninitialized( 8 );
+	for ( int32 i = 7; i >= 0; i-- )
+	{
+		Data[ Index + i ] = (uint8)Bits;
+		Bits >>= 8;
+	}
+}
+
+void FJsonLibraryCborWriter::WriteString( const TCHAR* Value, int32 Length )
+{
+	bool bAscii = true;
+	for ( int32 i = 0; i < Length && bAscii; i++ )
+		bAscii = Value[ i ] < 0x80;
+
+	if ( bAscii )
+	{
+		WriteHead( JsonLibraryCbor::MajorText, Length );
+		const int32 Index = Data.AddUninitialized( Length );
+		for ( int32 i = 0; i < Length; i++ )
+			Data[ Index + i ] = (uint8)Value[ i ];
+		return;
+	}
+
+	FTCHARToUTF8 Converter( Value, Length );
+	WriteHead( JsonLibraryCbor::MajorText, Converter.Length() );
+	Data.Append( (const uint8*)Converter.Get(), Converter.Length() );
+}
+
+void FJsonLibraryCborWriter::WriteTypedArray( uint8 Tag, const void* Values, int32 Num, int32 ElementSize )
+{
+	// elements are copied in native byte order, which the tag records
+	WriteHead( JsonLibraryCbor::MajorTag, Tag );
+	WriteHead( JsonLibraryCbor::MajorBytes, (uint64)Num * ElementSize );
+	Data.Append( (const uint8*)Values, Num * ElementSize );
+}
+
+void FJsonLibraryCborWriter::WriteJsonArray( const TArray<TSharedPtr<FJsonValue>>& Values )
+{
+	if ( bTypedArrays && Values.Num() >= JsonLibraryCbor::MinTypedArray )
+	{
+		// lists of integers are already compact, other numeric lists are written as typed arrays
+		bool bNumbers = true;
+		bool bIntegers = true;
+		bool bFloats = true;
+		for ( const TSharedPtr<FJsonValue>& Value : Values )
+		{
+			if ( !Value.IsValid() || Value->Type != EJson::Number )
+			{
+				bNumbers = false;
+				break;
+			}
+
+			const double Number = Value->AsNumber();
+			bIntegers = bIntegers && JsonLibraryCbor::IsInteger( Number );
+			bFloats = bFloats && (double)(float)Number == Number;
+		}
+
+		if ( bNumbers && !bIntegers )
+		{
+			if ( bFloats )
+			{
+				TArray<float> Floats;
+				Floats.SetNumUninitialized( Values.Num() );
+				for ( int32 i = 0; i < Values.Num(); i++ )
+					Floats[ i ] = (float)Values[ i ]->AsNumber();
+
+				WriteFloatArray( Floats.GetData(), Floats.Num() );
+			}
+			else
+			{
+				TArray<double> Numbers;
+				Numbers.SetNumUninitialized( Values.Num() );
+				for ( int32 i = 0; i < Values.Num(); i++ )
+					Numbers[ i ] = Values[ i ]->AsNumber();
+
+				WriteNumberArray( Numbers.GetData(), Numbers.Num() );
+			}
+			return;
+		}
+	}
+
+	WriteHead( JsonLibraryCbor::MajorArray, Values.Num() );
+	for ( const TSharedPtr<FJsonValue>& Value : Values )
+		WriteValue( Value );
+}
+
+
+FJsonLibraryCborReader::FJsonLibraryCborReader( const uint8* InData, int32 InSize )
+	: Data( InData )
+	, Size( InData ? InSize : 0 )
+	, Offset( 0 )
+	, NumberValue( 0.0 )
+	, bBooleanValue( false )
+{
+}
+
+bool FJsonLibraryCborReader::ReadNext( EJsonNotation& Notation )
+{
+	Notation = EJsonNotation::Error;
+	if ( !ErrorMessage.IsEmpty() )
+		return false;
+
+	Identifier.Reset();
+	if ( Stack.Num() <= 0 )
+	{
+		if ( Offset >= Size )
+			return false;
+
+		return ReadItem( Notation );
+	}
+
+	FFrame& Frame = Stack.Last();
+	if ( Frame.ElementSize > 0 )
+	{
+		if ( Frame.Remaining <= 0 )
+		{
+			Stack.Pop( false );
+			Notation = EJsonNotation::ArrayEnd;
+			return true;
+		}
+
+		if ( !ReadTypedElement( Frame ) )
+			return false;
+
+		Notation = EJsonNotation::Number;
+		return true;
+	}
+
+	bool bEnd = Frame.Remaining == 0;
+	if ( Frame.Remaining < 0 )
+	{
+		if ( Offset >= Size )
+			return Fail( TEXT( "Unexpected end of data" ) );
+
+		if ( Data[ Offset ] == JsonLibraryCbor::Break )
+		{
+			Offset++;
+			bEnd = true;
+		}
+	}
+	else if ( !bEnd )
+		Frame.Remaining--;
+
+	if ( bEnd )
+	{
+		Notation = Frame.bObject ? EJsonNotation::ObjectEnd : EJsonNotation::ArrayEnd;
+		Stack.Pop( false );
+		return true;
+	}
+
+	if ( Frame.bObject && !ReadKey() )
+		return false;
+
+	return ReadItem( Notation );
+}
+
+bool FJsonLibraryCborReader::IsTypedArray() const
+{
+	return Stack.Num() > 0 && Stack.Last().ElementSize > 0;
+}
+
+bool FJsonLibraryCborReader::ReadFloatArray( TArray<float>& Array )
+{
+	return ReadTypedArray( Array );
+}
+
+bool FJsonLibraryCborReader::ReadNumberArray( TArray<double>& Array )
+{
+	return ReadTypedArray( Array );
+}
+
+template<typename NumberType>
+bool FJsonLibraryCborReader::ReadTypedArray( TArray<NumberType>& Array )
+{
+	Array.Reset();
+	if ( Stack.Num() <= 0 || Stack.Last().bObject )
+		return Fail( TEXT( "Not in an array" ) );
+
+	FFrame& Frame = Stack.Last();
+	if ( Frame.ElementSize > 0 )
+	{
+		const int32 Num = (int32)Frame.Remaining;
+		if ( Frame.bFloat && Frame.ElementSize == sizeof( NumberType ) && Frame.bLittleEndian == !!PLATFORM_LITTLE_ENDIAN )
+		{
+			Array.SetNumUninitialized( Num );
+			FMemory::Memcpy( Array.GetData(), Frame.Elements, Num * sizeof( NumberType ) );
+		}
+		else
+		{
+			Array.SetNumUninitialized( Num );
+			for ( int32 i = 0; i < Num; i++ )
+			{
+				if ( !ReadTypedElement( Frame ) )
+					return false;
+
+				Array[ i ] = (NumberType)NumberValue;
+			}
+		}
+
+		Stack.Pop( false );
+		return true;
+	}
+
+	Array.Reserve( GetReserveNum( Frame ) );
+
+	EJsonNotation Notation;
+	while ( ReadNext( Notation ) )
+	{
+		if ( Notation == EJsonNotation::ArrayEnd )
+			return true;
+		else if ( Notation == EJsonNotation::Number )
+			Array.Add( (NumberType)NumberValue );
+		else if ( Notation == EJsonNotation::Null )
+			Array.Add( 0 );
+		else
+			return Fail( TEXT( "Expected a number" ) );
+	}
+
+	return false;
+}
+
+bool FJsonLibraryCborReader::ReadValue( TSharedPtr<FJsonValue>& Value )
+{
+	EJsonNotation Notation;
+	if ( !ReadNext( Notation ) )
+		return false;
+
+	return ReadValue( Notation, Value );
+}
+
+bool FJsonLibraryCborReader::ReadValue( EJsonNotation Notation, TSharedPtr<FJsonValue>& Value )
+{
+	switch ( Notation )
+	{
+	case EJsonNotation::Boolean:
+		Value = MakeShareable( new FJsonValueBoolean( bBooleanValue ) );
+		return true;
+	case EJsonNotation::Number:
+		Value = MakeShareable( new FJsonValueNumber( NumberValue ) );
+		return true;
+	case EJsonNotation::String:
+		Value = MakeShareable( new FJsonValueString( StringValue ) );
+		return true;
+	case EJsonNotation::Null:
+		Value = MakeShareable( new FJsonValueNull() );
+		return true;
+	case EJsonNotation::ArrayStart:
+	{
+		TArray<TSharedPtr<FJsonValue>> Array;
+		if ( IsTypedArray() )
+		{
+			FFrame& Frame = Stack.Last();
+			Array.Reserve( GetReserveNum( Frame ) );
+			while ( Frame.Remaining > 0 )
+			{
+				if ( !ReadTypedElement( Frame ) )
+					return false;
+
+				Array.Add( MakeShareable( new FJsonValueNumber( NumberValue ) ) );
+			}
+
+			Stack.Pop( false );
+		}
+		else
+		{
+			EJsonNotation Next;
+			while ( true )
+			{
+				if ( !ReadNext( Next ) )
+					return Fail( TEXT( "Unexpected end of array" ) );
+				if ( Next == EJsonNotation::ArrayEnd )
+					break;
+
+				TSharedPtr<FJsonValue> Item;
+				if ( !ReadValue( Next, Item ) )
+					return false;
+
+				Array.Add( Item );
+			}
+		}
+
+		Value = MakeShareable( new FJsonValueArray( Array ) );
+		return true;
+	}
+	case EJsonNotation::ObjectStart:
+	{
+		TSharedPtr<FJsonObject> Object = MakeShareable( new FJsonObject() );
+
+		EJsonNotation Next;
+		while ( true )
+		{
+			if ( !ReadNext( Next ) )
+				return Fail( TEXT( "Unexpected end of object" ) );
+			if ( Next == EJsonNotation::ObjectEnd )
+				break;
+
+			const FString Key = Identifier;
+
+			TSharedPtr<FJsonValue> Item;
+			if ( !ReadValue( Next, Item ) )
+				return false;
+
+			Object->SetField( Key, Item );
+		}
+
+		Value = MakeShareable( new FJsonValueObject( Object ) );
+		return true;
+	}
+	default:
+		return Fail( TEXT( "Unexpected token" ) );
+	}
+}
+
+bool FJsonLibraryCborReader::Fail( const TCHAR* Message )
+{
+	if ( ErrorMessage.IsEmpty() )
+		ErrorMessage = FString::Printf( TEXT( "%s at byte %d" ), Message, Offset );
+
+	return false;
+}
+
+bool FJsonLibraryCborReader::ReadHead( uint8& Major, uint8& Additional, uint64& Value )
+{
+	if ( Offset >= Size )
+		return Fail( TEXT( "Unexpected end of data" ) );
+
+	const uint8 Initial = Data[ Offset++ ];
+	Major = Initial >> 5;
+	Additional = Initial & 0x1F;
+
+	if ( Additional < 24 || Additional == JsonLibraryCbor::AdditionalIndefinite )
+	{
+		Value = Additional < 24 ? Additional : 0;
+		return true;
+	}
+	if ( Additional > 27 )
+		return Fail( TEXT( "Invalid additional information" ) );
+
+	const int32 Bytes = 1 << ( Additional - 24 );
+	if ( Size - Offset < Bytes )
+		return Fail( TEXT( "Unexpected end of data" ) );
+
+	Value = 0;
+	for ( int32 i = 0; i < Bytes; i++ )
+		Value = ( Value << 8 ) | Data[ Offset++ ];
+
+	return true;
+}
+
+bool FJsonLibraryCborReader::ReadBytes( uint8 Major, uint8 Additional, uint64 Length, TArray<uint8>& Bytes )
+{
+	if ( Additional != JsonLibraryCbor::AdditionalIndefinite )
+	{
+		if ( Length > (uint64)( Size - Offset ) )
+			return Fail( TEXT( "Unexpected end of data" ) );
+
+		Bytes.Append( Data + Offset, (int32)Length );
+		Offset += (int32)Length;
+		return true;
+	}
+
+	// indefinite strings are a sequence of definite chunks
+	while ( true )
+	{
+		if ( Offset >= Size )
+			return Fail( TEXT( "Unexpected end of data" ) );
+		if ( Data[ Offset ] == JsonLibraryCbor::Break )
+		{
+			Offset++;
+			return true;
+		}
+
+		uint8 ChunkMajor, ChunkAdditional;
+		uint64 ChunkLength;
+		if ( !ReadHead( ChunkMajor, ChunkAdditional, ChunkLength ) )
+			return false;
+		if ( ChunkMajor != Major || ChunkAdditional == JsonLibraryCbor::AdditionalIndefinite )
+			return Fail( TEXT( "Invalid string chunk" ) );
+		if ( !ReadBytes( ChunkMajor, ChunkAdditional, ChunkLength, Bytes ) )
+			return false;
+	}
+}
+
+bool FJsonLibraryCborReader::ReadKey()
+{
+	while ( true )
+	{
+		uint8 Major, Additional;
+		uint64 Value;
+		if ( !ReadHead( Major, Additional, Value ) )
+			return false;
+
+		switch ( Major )
+		{
+		case JsonLibraryCbor::MajorUnsigned:
+			Identifier = FString::Printf( TEXT( "%llu" ), Value );
+			return true;
+		case JsonLibraryCbor::MajorNegative:
+			Identifier = FString::Printf( TEXT( "-%llu" ), Value + 1 );
+			return true;
+		case JsonLibraryCbor::MajorText:
+		{
+			TArray<uint8> Bytes;
+			if ( !ReadBytes( Major, Additional, Value, Bytes ) )
+				return false;
+
+			FUTF8ToTCHAR Converter( (const ANSICHAR*)Bytes.GetData(), Bytes.Num() );
+			Identifier = FString( Converter.Length(), Converter.Get() );
+			return true;
+		}
+		case JsonLibraryCbor::MajorTag:
+			continue;
+		default:
+			return Fail( TEXT( "Unsupported object key" ) );
+		}
+	}
+}
+
+bool FJsonLibraryCborReader::ReadItem( EJsonNotation& Notation )
+{
+	while ( true )
+	{
+		uint8 Major, Additional;
+		uint64 Value;
+		if ( !ReadHead( Major, Additional, Value ) )
+			return false;
+
+		switch ( Major )
+		{
+		case JsonLibraryCbor::MajorUnsigned:
+			NumberValue = (double)Value;
+			Notation = EJsonNotation::Number;
+			return true;
+		case JsonLibraryCbor::MajorNegative:
+			NumberValue = -1.0 - (double)Value;
+			Notation = EJsonNotation::Number;
+			return true;
+		case JsonLibraryCbor::MajorBytes:
+		{
+			// JSON has no byte strings, so they are read as base64
+			TArray<uint8> Bytes;
+			if ( !ReadBytes( Major, Additional, Value, Bytes ) )
+				return false;
+
+			StringValue = FBase64::Encode( Bytes );
+			Notation = EJsonNotation::String;
+			return true;
+		}
+		case JsonLibraryCbor::MajorText:
+		{
+			TArray<uint8> Bytes;
+			if ( !ReadBytes( Major, Additional, Value, Bytes ) )
+				return false;
+
+			FUTF8ToTCHAR Converter( (const ANSICHAR*)Bytes.GetData(), Bytes.Num() );
+			StringValue = FString( Converter.Length(), Converter.Get() );
+			Notation = EJsonNotation::String;
+			return true;
+		}
+		case JsonLibraryCbor::MajorArray:
+		case JsonLibraryCbor::MajorMap:
+		{
+			if ( Stack.Num() >= JsonLibraryCbor::MaxDepth )
+				return Fail( TEXT( "Too deeply nested" ) );
+
+			FFrame& Frame = Stack.AddZeroed_GetRef();
+			Frame.bObject = Major == JsonLibraryCbor::MajorMap;
+			Frame.Remaining = Additional == JsonLibraryCbor::AdditionalIndefinite ? -1 : (int64)FMath::Min<uint64>( Value, MAX_int64 );
+
+			Notation = Frame.bObject ? EJsonNotation::ObjectStart : EJsonNotation::ArrayStart;
+			return true;
+		}
+		case JsonLibraryCbor::MajorTag:
+		{
+			// other tags don't change how the value reads as JSON
+			if ( Value < JsonLibraryCbor::TagTypedFirst || Value > JsonLibraryCbor::TagTypedLast
+			  || Offset >= Size || ( Data[ Offset ] >> 5 ) != JsonLibraryCbor::MajorBytes )
+				continue;
+
+			const uint8 Tag = (uint8)Value;
+			uint8 BytesMajor, BytesAdditional;
+			uint64 Length;
+			if ( !ReadHead( BytesMajor, BytesAdditional, Length ) )
+				return false;
+			if ( BytesAdditional == JsonLibraryCbor::AdditionalIndefinite )
+				return Fail( TEXT( "Unsupported indefinite typed array" ) );
+
+			FFrame Frame;
+			FMemory::Memzero( Frame );
+			Frame.bFloat = ( Tag & 0x10 ) != 0;
+			Frame.bSigned = !Frame.bFloat && ( Tag & 0x08 ) != 0;
+			Frame.bLittleEndian = ( Tag & 0x04 ) != 0;
+			Frame.ElementSize = Frame.bFloat ? 2 << ( Tag & 0x03 ) : 1 << ( Tag & 0x03 );
+			if ( Frame.ElementSize > 8 || Tag == 76 )
+				return Fail( TEXT( "Unsupported typed array" ) );
+			if ( Length > (uint64)( Size - Offset ) || Length % Frame.ElementSize != 0 )
+				return Fail( TEXT( "Invalid typed array length" ) );
+
+			Frame.Remaining = (int64)( Length / Frame.ElementSize );
+			Frame.Elements = Data + Offset;
+			Offset += (int32)Length;
+
+			Stack.Add( Frame );
+			Notation = EJsonNotation::ArrayStart;
+			return true;
+		}
+		case JsonLibraryCbor::MajorSimple:
+		default:
+			break;
+		}
+
+		switch ( Additional )
+		{
+		case JsonLibraryCbor::AdditionalFalse:
+		case JsonLibraryCbor::AdditionalTrue:
+			bBooleanValue = Additional == JsonLibraryCbor::AdditionalTrue;
+			Notation = EJsonNotation::Boolean;
+			return true;
+		case JsonLibraryCbor::AdditionalHalf:
+			NumberValue = JsonLibraryCbor::HalfToDouble( (uint16)Value );
+			Notation = EJsonNotation::Number;
+			return true;
+		case JsonLibraryCbor::AdditionalFloat:
+		{
+			const uint32 Bits = (uint32)Value;
+			float Float;
+			FMemory::Memcpy( &Float, &Bits, sizeof( Float ) );
+
+			NumberValue = Float;
+			Notation = EJsonNotation::Number;
+			return true;
+		}
+		case JsonLibraryCbor::AdditionalDouble:
+			FMemory::Memcpy( &NumberValue, &Value, sizeof( NumberValue ) );
+			Notation = EJsonNotation::Number;
+			return true;
+		case JsonLibraryCbor::AdditionalIndefinite:
+			return Fail( TEXT( "Unexpected break" ) );
+		default:
+			// null, undefined and unassigned simple values
+			Notation = EJsonNotation::Null;
+			return true;
+		}
+	}
+}
+
+int32 FJsonLibraryCborReader::GetReserveNum( const FFrame& Frame ) const
+{
+	if ( Frame.Remaining <= 0 )
+		return 0;
+
+	// a count read from the data is only trusted as far as the data left can hold it; every item takes at least one byte
+	const int64 Available = Frame.ElementSize > 0 ? Frame.Remaining : (int64)( Size - Offset );
+	return (int32)FMath::Min<int64>( FMath::Min<int64>( Frame.Remaining, Available ), MAX_int32 );
+}
+
+bool FJsonLibraryCborReader::ReadTypedElement( FFrame& Frame )
+{
+	if ( Frame.Remaining <= 0 )
+		return Fail( TEXT( "Unexpected end of typed array" ) );
+
+	uint64 Bits = 0;
+	for ( int32 i = 0; i < Frame.ElementSize; i++ )
+	{
+		const int32 Index = Frame.bLittleEndian ? Frame.ElementSize - 1 - i : i;
+		Bits = ( Bits << 8 ) | Frame.Elements[ Index ];
+	}
+
+	Frame.Elements += Frame.ElementSize;
+	Frame.Remaining--;
+
+	if ( Frame.bFloat )
+	{
+		if ( Frame.ElementSize == 2 )
+			NumberValue = JsonLibraryCbor::HalfToDouble( (uint16)Bits );
+		else if ( Frame.ElementSize == 4 )
+		{
+			const uint32 Bits32 = (uint32)Bits;
+			float Float;
+			FMemory::Memcpy( &Float, &Bits32, sizeof( Float ) );
+			NumberValue = Float;
+		}
+		else
+			FMemory::Memcpy( &NumberValue, &Bits, sizeof( NumberValue ) );
+	}
+	else if ( Frame.bSigned )
+	{
+		// sign extend
+		const int32 Shift = 64 - Frame.ElementSize * 8;
+		NumberValue = (double)( (int64)( Bits << Shift ) >> Shift );
+	}
+	else
+		NumberValue = (double)Bits;
+
+	return true;
+}
@@ -11,6 +11,9 @@
 #include "UObject/Package.h"
 #include "Policies/CondensedJsonPrintPolicy.h"
 #include "Engine/UserDefinedStruct.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/ObjectKey.h"
+#include "JsonLibraryNumberCodec.h"
 
 FString FJsonLibraryConverter::StandardizeCase(const FString &StringIn)
 {
@@ -22,6 +25,320 @@ FString FJsonLibraryConverter::StandardizeCase(const FString &StringIn)
 }
 
 
+namespace
+{
+/** Name of a property as authored, stripping the GUID postfix of user defined struct members (UUserDefinedStruct::GetAuthoredNameForField) */
+FString GetAuthoredPropertyName(const FProperty* Property, bool bUserStruct)
+{
+	FString OriginalName = Property->GetName();
+	if (bUserStruct)
+	{
+		const int32 GuidStrLen = 32;
+		const int32 MinimalPostfixlen = GuidStrLen + 3;
+		if (OriginalName.Len() > MinimalPostfixlen)
+		{
+			FString DisplayName = OriginalName.LeftChop(GuidStrLen + 1);
+			int FirstCharToRemove = -1;
+			const bool bCharFound = DisplayName.FindLastChar(TCHAR('_'), FirstCharToRemove);
+			if (bCharFound && (FirstCharToRemove > 0))
+			{
+				OriginalName = DisplayName.Mid(0, FirstCharToRemove);
+			}
+		}
+	}
+	return OriginalName;
+}
+
+/** Typed thunks for scalar properties, matching what the generic conversion would produce */
+typedef TSharedPtr<FJsonValue> (*FPlannedWriteFunc)(const FProperty* Property, const void* Value);
+typedef void (*FPlannedReadFunc)(const FProperty* Property, const FJsonValue& JsonValue, void* OutValue);
+
+TSharedPtr<FJsonValue> WritePlannedBool(const FProperty* Property, const void* Value)
+{
+	return MakeShared<FJsonValueBoolean>(static_cast<const FBoolProperty*>(Property)->GetPropertyValue(Value));
+}
+
+TSharedPtr<FJsonValue> WritePlannedFloat(const FProperty* Property, const void* Value)
+{
+	return MakeShared<FJsonValueNumber>(*(const float*)Value);
+}
+
+TSharedPtr<FJsonValue> WritePlannedDouble(const FProperty* Property, const void* Value)
+{
+	return MakeShared<FJsonValueNumber>(*(const double*)Value);
+}
+
+TSharedPtr<FJsonValue> WritePlannedInt32(const FProperty* Property, const void* Value)
+{
+	return MakeShared<FJsonValueNumber>(*(const int32*)Value);
+}
+
+TSharedPtr<FJsonValue> WritePlannedInteger(const FProperty* Property, const void* Value)
+{
+	return MakeShared<FJsonValueNumber>(static_cast<const FNumericProperty*>(Property)->GetSignedIntPropertyValue(Value));
+}
+
+TSharedPtr<FJsonValue> WritePlannedString(const FProperty* Property, const void* Value)
+{
+	return MakeShared<FJsonValueString>(*(const FString*)Value);
+}
+
+void ReadPlannedBool(const FProperty* Property, const FJsonValue& JsonValue, void* OutValue)
+{
+	// AsBool will log an error for completely inappropriate types (then give us a default)
+	static_cast<const FBoolProperty*>(Property)->SetPropertyValue(OutValue, JsonValue.AsBool());
+}
+
+void ReadPlannedFloat(const FProperty* Property, const FJsonValue& JsonValue, void* OutValue)
+{
+	*(float*)OutValue = (float)JsonValue.AsNumber();
+}
+
+void ReadPlannedDouble(const FProperty* Property, const FJsonValue& JsonValue, void* OutValue)
+{
+	*(double*)OutValue = JsonValue.AsNumber();
+}
+
+void ReadPlannedInt32(const FProperty* Property, const FJsonValue& JsonValue, void* OutValue)
+{
+	// parse string -> int64 ourselves so we don't lose any precision going through AsNumber (aka double)
+	*(int32*)OutValue = (int32)(JsonValue.Type == EJson::String ? FCString::Atoi64(*JsonValue.AsString()) : (int64)JsonValue.AsNumber());
+}
+
+void ReadPlannedInteger(const FProperty* Property, const FJsonValue& JsonValue, void* OutValue)
+{
+	static_cast<const FNumericProperty*>(Property)->SetIntPropertyValue(OutValue, JsonValue.Type == EJson::String ? FCString::Atoi64(*JsonValue.AsString()) : (int64)JsonValue.AsNumber());
+}
+
+void ReadPlannedString(const FProperty* Property, const FJsonValue& JsonValue, void* OutValue)
+{
+	*(FString*)OutValue = JsonValue.AsString();
+}
+
+/** How a planned property is converted */
+enum class EPlannedKind : uint8
+{
+	Generic,
+	Bool,
+	Float,
+	Double,
+	Int32,
+	Integer,
+	String,
+	Struct,
+	Array,
+};
+
+/** A single property of a conversion plan */
+struct FJsonLibraryConverterField
+{
+	FProperty* Property;
+	int32 Offset;
+	EPlannedKind Kind;
+
+	/** Key written to JSON (standardized case) */
+	FString JsonName;
+	/** Key looked up when reading JSON (authored name) */
+	FString AuthoredName;
+
+	/** Typed thunks, null when the property needs the generic path */
+	FPlannedWriteFunc Write;
+	FPlannedReadFunc Read;
+};
+
+/** Filtered properties of a UStruct with precomputed keys and offsets */
+struct FJsonLibraryConverterPlan
+{
+	/** Used to detect a struct that was relinked (hot reload, user defined struct recompile) */
+	FProperty* PropertyLink;
+	int32 PropertiesSize;
+
+	TArray<FJsonLibraryConverterField> Fields;
+	/** Index into Fields by authored name (case insensitive, like the attribute lookup) */
+	TMap<FString, int32> FieldIndices;
+
+	bool IsCurrent(const UStruct* StructDefinition) const
+	{
+		return PropertyLink == StructDefinition->PropertyLink && PropertiesSize == StructDefinition->GetPropertiesSize();
+	}
+};
+
+typedef TSharedPtr<const FJsonLibraryConverterPlan, ESPMode::ThreadSafe> FJsonLibraryConverterPlanPtr;
+
+struct FJsonLibraryConverterPlanKey
+{
+	TWeakObjectPtr<UStruct> Struct;
+	int64 CheckFlags;
+	int64 SkipFlags;
+
+	bool operator==(const FJsonLibraryConverterPlanKey& Other) const
+	{
+		return Struct == Other.Struct && CheckFlags == Other.CheckFlags && SkipFlags == Other.SkipFlags;
+	}
+
+	friend uint32 GetTypeHash(const FJsonLibraryConverterPlanKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.Struct), HashCombine(GetTypeHash(Key.CheckFlags), GetTypeHash(Key.SkipFlags)));
+	}
+};
+
+EPlannedKind MakePlannedThunks(FProperty* Property, FPlannedWriteFunc& OutWrite, FPlannedReadFunc& OutRead)
+{
+	OutWrite = nullptr;
+	OutRead = nullptr;
+
+	// static arrays go through the generic path
+	if (Property->ArrayDim != 1)
+	{
+		return EPlannedKind::Generic;
+	}
+
+	if (CastField<FBoolProperty>(Property))
+	{
+		OutWrite = &WritePlannedBool;
+		OutRead = &ReadPlannedBool;
+		return EPlannedKind::Bool;
+	}
+	else if (CastField<FFloatProperty>(Property))
+	{
+		OutWrite = &WritePlannedFloat;
+		OutRead = &ReadPlannedFloat;
+		return EPlannedKind::Float;
+	}
+	else if (CastField<FDoubleProperty>(Property))
+	{
+		OutWrite = &WritePlannedDouble;
+		OutRead = &ReadPlannedDouble;
+		return EPlannedKind::Double;
+	}
+	else if (CastField<FIntProperty>(Property))
+	{
+		OutWrite = &WritePlannedInt32;
+		OutRead = &ReadPlannedInt32;
+		return EPlannedKind::Int32;
+	}
+	else if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+	{
+		// enums are exported by name
+		if (NumericProperty->IsInteger() && NumericProperty->GetIntPropertyEnum() == nullptr)
+		{
+			OutWrite = &WritePlannedInteger;
+			OutRead = &ReadPlannedInteger;
+			return EPlannedKind::Integer;
+		}
+	}
+	else if (CastField<FStrProperty>(Property))
+	{
+		OutWrite = &WritePlannedString;
+		OutRead = &ReadPlannedString;
+		return EPlannedKind::String;
+	}
+	else if (CastField<FStructProperty>(Property))
+	{
+		return EPlannedKind::Struct;
+	}
+	else if (CastField<FArrayProperty>(Property))
+	{
+		return EPlannedKind::Array;
+	}
+
+	return EPlannedKind::Generic;
+}
+
+FJsonLibraryConverterPlanPtr BuildConverterPlan(const UStruct* StructDefinition, int64 CheckFlags, int64 SkipFlags)
+{
+	TSharedRef<FJsonLibraryConverterPlan, ESPMode::ThreadSafe> Plan = MakeShared<FJsonLibraryConverterPlan, ESPMode::ThreadSafe>();
+	Plan->PropertyLink = StructDefinition->PropertyLink;
+	Plan->PropertiesSize = StructDefinition->GetPropertiesSize();
+
+	const bool bUserStruct = StructDefinition->IsA(UUserDefinedStruct::StaticClass());
+	for (TFieldIterator<FProperty> It(StructDefinition); It; ++It)
+	{
+		FProperty* Property = *It;
+
+		// Check to see if we should ignore this property
+		if (CheckFlags != 0 && !Property->HasAnyPropertyFlags(CheckFlags))
+		{
+			continue;
+		}
+		if (Property->HasAnyPropertyFlags(SkipFlags))
+		{
+			continue;
+		}
+
+		FJsonLibraryConverterField& Field = Plan->Fields.AddDefaulted_GetRef();
+		Field.Property = Property;
+		Field.Offset = Property->GetOffset_ForInternal();
+		Field.AuthoredName = GetAuthoredPropertyName(Property, bUserStruct);
+		Field.JsonName = FJsonLibraryConverter::StandardizeCase(Field.AuthoredName);
+		Field.Kind = MakePlannedThunks(Property, Field.Write, Field.Read);
+
+		Plan->FieldIndices.Add(Field.AuthoredName, Plan->Fields.Num() - 1);
+	}
+
+	return Plan;
+}
+
+/** Conversion plans per UStruct and property filter, shared by all threads */
+class FJsonLibraryConverterPlanCache
+{
+public:
+
+	static FJsonLibraryConverterPlanCache& Get()
+	{
+		static FJsonLibraryConverterPlanCache Instance;
+		return Instance;
+	}
+
+	FJsonLibraryConverterPlanPtr Find(const UStruct* StructDefinition, int64 CheckFlags, int64 SkipFlags)
+	{
+		const FJsonLibraryConverterPlanKey Key = { const_cast<UStruct*>(StructDefinition), CheckFlags, SkipFlags };
+		{
+			FReadScopeLock ReadLock(Lock);
+			const FJsonLibraryConverterPlanPtr* Plan = Plans.Find(Key);
+			if (Plan && (*Plan)->IsCurrent(StructDefinition))
+			{
+				return *Plan;
+			}
+		}
+
+		FJsonLibraryConverterPlanPtr Plan = BuildConverterPlan(StructDefinition, CheckFlags, SkipFlags);
+		{
+			FWriteScopeLock WriteLock(Lock);
+
+			// Plans are rarely built, so this is a good time to drop the ones for structs that are gone
+			for (auto It = Plans.CreateIterator(); It; ++It)
+			{
+				if (!It.Key().Struct.IsValid())
+				{
+					It.RemoveCurrent();
+				}
+			}
+
+			Plans.Add(Key, Plan);
+		}
+		return Plan;
+	}
+
+	void Reset()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Plans.Empty();
+	}
+
+private:
+
+	FRWLock Lock;
+	TMap<FJsonLibraryConverterPlanKey, FJsonLibraryConverterPlanPtr> Plans;
+};
+}
+
+void FJsonLibraryConverter::ResetCachedPlans()
+{
+	FJsonLibraryConverterPlanCache::Get().Reset();
+}
+
+
 namespace
 {
 /** Convert property to JSON, assuming either the property is not an array or the value is an individual array element */
@@ -227,57 +544,26 @@ bool FJsonLibraryConverter::UStructToJsonAttributes(const UStruct* StructDefinit
 		SkipFlags |= CPF_Deprecated | CPF_Transient;
 	}
 
-// ---------- UUserDefinedStruct ----------
-	bool bUserStruct = StructDefinition->IsA( UUserDefinedStruct::StaticClass() );
-// ---------- UUserDefinedStruct ----------
-
-	for (TFieldIterator<FProperty> It(StructDefinition); It; ++It)
-	{
-		FProperty* Property = *It;
-
-		// Check to see if we should ignore this property
-		if (CheckFlags != 0 && !Property->HasAnyPropertyFlags(CheckFlags))
-		{
-			continue;
-		}
-		if (Property->HasAnyPropertyFlags(SkipFlags))
-		{
-			continue;
-		}
+	FJsonLibraryConverterPlanPtr Plan = FJsonLibraryConverterPlanCache::Get().Find(StructDefinition, CheckFlags, SkipFlags);
 
-// ---------- UUserDefinedStruct::GetAuthoredNameForField() ----------
-		FString OriginalName = Property->GetName();
-		if (bUserStruct)
-		{
-			const int32 GuidStrLen = 32;
-			const int32 MinimalPostfixlen = GuidStrLen + 3;
-			if (OriginalName.Len() > MinimalPostfixlen)
-			{
-				FString DisplayName = OriginalName.LeftChop(GuidStrLen + 1);
-				int FirstCharToRemove = -1;
-				const bool bCharFound = DisplayName.FindLastChar(TCHAR('_'), FirstCharToRemove);
-				if (bCharFound && (FirstCharToRemove > 0))
-				{
-					OriginalName = DisplayName.Mid(0, FirstCharToRemove);
-				}
-			}
-		}
-// ---------- UUserDefinedStruct::GetAuthoredNameForField() ----------
+	// the typed thunks bypass the export callback, so only use them when there is none
+	const bool bUseThunks = !(ExportCb && ExportCb->IsBound());
 
-		FString VariableName = StandardizeCase(OriginalName);
-		const void* Value = Property->ContainerPtrToValuePtr<uint8>(Struct);
+	for (const FJsonLibraryConverterField& Field : Plan->Fields)
+	{
+		const void* Value = (const uint8*)Struct + Field.Offset;
 
 		// convert the property to a FJsonValue
-		TSharedPtr<FJsonValue> JsonValue = UPropertyToJsonValue(Property, Value, CheckFlags, SkipFlags, ExportCb);
+		TSharedPtr<FJsonValue> JsonValue = bUseThunks && Field.Write ? Field.Write(Field.Property, Value) : UPropertyToJsonValue(Field.Property, Value, CheckFlags, SkipFlags, ExportCb);
 		if (!JsonValue.IsValid())
 		{
-			FFieldClass* PropClass = Property->GetClass();
-			UE_LOG(LogJson, Error, TEXT("UStructToJsonObject - Unhandled property type '%s': %s"), *PropClass->GetName(), *Property->GetPathName());
+			FFieldClass* PropClass = Field.Property->GetClass();
+			UE_LOG(LogJson, Error, TEXT("UStructToJsonObject - Unhandled property type '%s': %s"), *PropClass->GetName(), *Field.Property->GetPathName());
 			return false;
 		}
 
 		// set the value on the output object
-		OutJsonAttributes.Add(VariableName, JsonValue);
+		OutJsonAttributes.Add(Field.JsonName, JsonValue);
 	}
 
 	return true;
@@ -773,69 +1059,40 @@ namespace
 			return true;
 		}
 
-// ---------- UUserDefinedStruct ----------
-		bool bUserStruct = StructDefinition->IsA( UUserDefinedStruct::StaticClass() );
-// ---------- UUserDefinedStruct ----------
+		FJsonLibraryConverterPlanPtr Plan = FJsonLibraryConverterPlanCache::Get().Find(StructDefinition, CheckFlags, SkipFlags);
 
 	// iterate over the struct properties
-	for (TFieldIterator<FProperty> PropIt(StructDefinition); PropIt; ++PropIt)
+	for (const FJsonLibraryConverterField& Field : Plan->Fields)
 	{
-		FProperty* Property = *PropIt;
-
-		// Check to see if we should ignore this property
-		if (CheckFlags != 0 && !Property->HasAnyPropertyFlags(CheckFlags))
-		{
-			continue;
-		}
-		if (Property->HasAnyPropertyFlags(SkipFlags))
+		// find a json value matching this property name
+		const TSharedPtr<FJsonValue>* JsonValue = JsonAttributes.Find(Field.AuthoredName);
+		if (!JsonValue)
 		{
+			// we allow values to not be found since this mirrors the typical UObject mantra that all the fields are optional when deserializing
 			continue;
 		}
 
-// ---------- UUserDefinedStruct::GetAuthoredNameForField() ----------
-			FString OriginalName = Property->GetName();
-			if (bUserStruct)
+		if (JsonValue->IsValid() && !(*JsonValue)->IsNull())
+		{
+			void* Value = (uint8*)OutStruct + Field.Offset;
+			if (Field.Read && (*JsonValue)->Type != EJson::Array)
 			{
-				const int32 GuidStrLen = 32;
-				const int32 MinimalPostfixlen = GuidStrLen + 3;
-				if (OriginalName.Len() > MinimalPostfixlen)
-				{
-					FString DisplayName = OriginalName.LeftChop(GuidStrLen + 1);
-					int FirstCharToRemove = -1;
-					const bool bCharFound = DisplayName.FindLastChar(TCHAR('_'), FirstCharToRemove);
-					if (bCharFound && (FirstCharToRemove > 0))
-					{
-						OriginalName = DisplayName.Mid(0, FirstCharToRemove);
-					}
-				}
+				Field.Read(Field.Property, **JsonValue, Value);
+			}
+			else if (!JsonValueToFPropertyWithContainer(*JsonValue, Field.Property, Value, ContainerStruct, Container, CheckFlags, SkipFlags))
+			{
+				UE_LOG(LogJson, Error, TEXT("JsonObjectToUStruct - Unable to parse %s.%s from JSON"), *StructDefinition->GetName(), *Field.Property->GetName());
+				return false;
 			}
-// ---------- UUserDefinedStruct::GetAuthoredNameForField() ----------
-
-		// find a json value matching this property name
-			const TSharedPtr<FJsonValue>* JsonValue = JsonAttributes.Find(OriginalName);
-			if (!JsonValue)
-		{
-			// we allow values to not be found since this mirrors the typical UObject mantra that all the fields are optional when deserializing
-			continue;
 		}
 
-			if (JsonValue->IsValid() && !(*JsonValue)->IsNull())
-			{
-		void* Value = Property->ContainerPtrToValuePtr<uint8>(OutStruct);
-				if (!JsonValueToFPropertyWithContainer(*JsonValue, Property, Value, ContainerStruct, Container, CheckFlags, SkipFlags))
+		if (--NumUnclaimedProperties <= 0)
 		{
-					UE_LOG(LogJson, Error, TEXT("JsonObjectToUStruct - Unable to parse %s.%s from JSON"), *StructDefinition->GetName(), *Property->GetName());
-			return false;
+			// If we found all properties that were in the JsonAttributes map, there is no reason to keep looking for more.
+			break;
 		}
 	}
 
-			if (--NumUnclaimedProperties <= 0)
-			{
-				// If we found all properties that were in the JsonAttributes map, there is no reason to keep looking for more.
-				break;
-			}
-		}
-
 	return true;
 	}
 
@@ -933,4 +1190,843 @@ FFormatNamedArguments FJsonLibraryConverter::ParseTextArgumentsFromJson(const TS
 		}
 	}
 	return NamedArgs;
-}
\ No newline at end of file
+}
+
+namespace
+{
+/** Number codec entry points for TCHAR and UTF-8 buffers */
+FORCEINLINE TCHAR* AsCodecChars(TCHAR* Chars) { return Chars; }
+FORCEINLINE ANSICHAR* AsCodecChars(uint8* Chars) { return (ANSICHAR*)Chars; }
+FORCEINLINE const TCHAR* AsCodecChars(const TCHAR* Chars) { return Chars; }
+FORCEINLINE const ANSICHAR* AsCodecChars(const uint8* Chars) { return (const ANSICHAR*)Chars; }
+
+/** Writes condensed JSON straight from struct memory into a TCHAR or UTF-8 buffer */
+template<typename CharType>
+class TJsonLibraryTextWriter
+{
+public:
+
+	explicit TJsonLibraryTextWriter(TArray<CharType>& InBuffer)
+		: Buffer(InBuffer)
+	{
+	}
+
+	bool WriteStruct(const UStruct* StructDefinition, const void* Struct, int64 CheckFlags, int64 SkipFlags)
+	{
+		FJsonLibraryConverterPlanPtr Plan = FJsonLibraryConverterPlanCache::Get().Find(StructDefinition, CheckFlags, SkipFlags);
+
+		Buffer.Add('{');
+		for (int32 Index = 0; Index < Plan->Fields.Num(); ++Index)
+		{
+			const FJsonLibraryConverterField& Field = Plan->Fields[Index];
+			if (Index > 0)
+			{
+				Buffer.Add(',');
+			}
+
+			WriteString(Field.JsonName);
+			Buffer.Add(':');
+
+			if (!WriteProperty(Field.Property, Field.Kind, (const uint8*)Struct + Field.Offset, CheckFlags, SkipFlags))
+			{
+				FFieldClass* PropClass = Field.Property->GetClass();
+				UE_LOG(LogJson, Error, TEXT("UStructToJsonText - Unhandled property type '%s': %s"), *PropClass->GetName(), *Field.Property->GetPathName());
+				return false;
+			}
+		}
+		Buffer.Add('}');
+
+		return true;
+	}
+
+private:
+
+	TArray<CharType>& Buffer;
+
+	bool WriteProperty(FProperty* Property, EPlannedKind Kind, const void* Value, int64 CheckFlags, int64 SkipFlags)
+	{
+		switch (Kind)
+		{
+			case EPlannedKind::Bool:
+				WriteLiteral(static_cast<const FBoolProperty*>(Property)->GetPropertyValue(Value) ? "true" : "false");
+				return true;
+			case EPlannedKind::Float:
+				WriteFloat(*(const float*)Value);
+				return true;
+			case EPlannedKind::Double:
+				WriteDouble(*(const double*)Value);
+				return true;
+			case EPlannedKind::Int32:
+				WriteInteger(*(const int32*)Value);
+				return true;
+			case EPlannedKind::Integer:
+				WriteInteger(static_cast<const FNumericProperty*>(Property)->GetSignedIntPropertyValue(Value));
+				return true;
+			case EPlannedKind::String:
+				WriteString(*(const FString*)Value);
+				return true;
+			case EPlannedKind::Struct:
+				return WriteStruct(static_cast<const FStructProperty*>(Property)->Struct, Value, CheckFlags & (~CPF_ParmFlags), SkipFlags);
+			case EPlannedKind::Array:
+			{
+				FArrayProperty* ArrayProperty = static_cast<FArrayProperty*>(Property);
+				FPlannedWriteFunc InnerWrite;
+				FPlannedReadFunc InnerRead;
+				const EPlannedKind InnerKind = MakePlannedThunks(ArrayProperty->Inner, InnerWrite, InnerRead);
+
+				FScriptArrayHelper Helper(ArrayProperty, Value);
+				Buffer.Add('[');
+				for (int32 i = 0, n = Helper.Num(); i < n; ++i)
+				{
+					if (i > 0)
+					{
+						Buffer.Add(',');
+					}
+					if (!WriteProperty(ArrayProperty->Inner, InnerKind, Helper.GetRawPtr(i), CheckFlags & (~CPF_ParmFlags), SkipFlags))
+					{
+						return false;
+					}
+				}
+				Buffer.Add(']');
+				return true;
+			}
+			default:
+			{
+				// everything else goes through the DOM for this value only
+				TSharedPtr<FJsonValue> JsonValue = FJsonLibraryConverter::UPropertyToJsonValue(Property, Value, CheckFlags, SkipFlags, nullptr);
+				if (!JsonValue.IsValid())
+				{
+					return false;
+				}
+				WriteJsonValue(*JsonValue);
+				return true;
+			}
+		}
+	}
+
+	void WriteJsonValue(const FJsonValue& JsonValue)
+	{
+		switch (JsonValue.Type)
+		{
+			case EJson::Boolean:
+				WriteLiteral(JsonValue.AsBool() ? "true" : "false");
+				break;
+			case EJson::Number:
+				WriteDouble(JsonValue.AsNumber());
+				break;
+			case EJson::String:
+				WriteString(JsonValue.AsString());
+				break;
+			case EJson::Array:
+			{
+				const TArray<TSharedPtr<FJsonValue>>& Array = JsonValue.AsArray();
+				Buffer.Add('[');
+				for (int32 i = 0; i < Array.Num(); ++i)
+				{
+					if (i > 0)
+					{
+						Buffer.Add(',');
+					}
+					if (Array[i].IsValid())
+					{
+						WriteJsonValue(*Array[i]);
+					}
+					else
+					{
+						WriteLiteral("null");
+					}
+				}
+				Buffer.Add(']');
+				break;
+			}
+			case EJson::Object:
+			{
+				const TSharedPtr<FJsonObject>& Object = JsonValue.AsObject();
+				Buffer.Add('{');
+				if (Object.IsValid())
+				{
+					bool bFirst = true;
+					for (const auto& Pair : Object->Values)
+					{
+						if (!bFirst)
+						{
+							Buffer.Add(',');
+						}
+						bFirst = false;
+
+						WriteString(Pair.Key);
+						Buffer.Add(':');
+						if (Pair.Value.IsValid())
+						{
+							WriteJsonValue(*Pair.Value);
+						}
+						else
+						{
+							WriteLiteral("null");
+						}
+					}
+				}
+				Buffer.Add('}');
+				break;
+			}
+			default:
+				WriteLiteral("null");
+				break;
+		}
+	}
+
+	void WriteLiteral(const ANSICHAR* Literal)
+	{
+		while (*Literal)
+		{
+			Buffer.Add(*Literal++);
+		}
+	}
+
+	void WriteFloat(float Value)
+	{
+		const int32 Offset = Buffer.AddUninitialized(FJsonLibraryNumberCodec::MaxFloatChars);
+		const int32 Length = FJsonLibraryNumberCodec::WriteFloat(Value, AsCodecChars(Buffer.GetData() + Offset));
+		Buffer.SetNum(Offset + Length, false);
+	}
+
+	void WriteDouble(double Value)
+	{
+		const int32 Offset = Buffer.AddUninitialized(FJsonLibraryNumberCodec::MaxDoubleChars);
+		const int32 Length = FJsonLibraryNumberCodec::WriteDouble(Value, AsCodecChars(Buffer.GetData() + Offset));
+		Buffer.SetNum(Offset + Length, false);
+	}
+
+	void WriteInteger(int64 Value)
+	{
+		const int32 Offset = Buffer.AddUninitialized(FJsonLibraryNumberCodec::MaxIntegerChars);
+		const int32 Length = FJsonLibraryNumberCodec::WriteInteger(Value, AsCodecChars(Buffer.GetData() + Offset));
+		Buffer.SetNum(Offset + Length, false);
+	}
+
+	void WriteString(const FString& String)
+	{
+		static const ANSICHAR* HexDigits = "0123456789abcdef";
+
+		const TCHAR* Chars = *String;
+		const int32 Length = String.Len();
+
+		Buffer.Add('"');
+
+		int32 RunStart = 0;
+		for (int32 i = 0; i < Length; ++i)
+		{
+			const TCHAR Char = Chars[i];
+			if (Char >= 0x20 && Char != TEXT('"') && Char != TEXT('\\'))
+			{
+				continue;
+			}
+
+			AppendRun(Chars + RunStart, i - RunStart);
+			RunStart = i + 1;
+
+			Buffer.Add('\\');
+			switch (Char)
+			{
+				case TEXT('"'):  Buffer.Add('"');  break;
+				case TEXT('\\'): Buffer.Add('\\'); break;
+				case TEXT('\b'): Buffer.Add('b');  break;
+				case TEXT('\f'): Buffer.Add('f');  break;
+				case TEXT('\n'): Buffer.Add('n');  break;
+				case TEXT('\r'): Buffer.Add('r');  break;
+				case TEXT('\t'): Buffer.Add('t');  break;
+				default:
+					Buffer.Add('u');
+					Buffer.Add('0');
+					Buffer.Add('0');
+					Buffer.Add(HexDigits[(Char >> 4) & 0xF]);
+					Buffer.Add(HexDigits[Char & 0xF]);
+					break;
+			}
+		}
+		AppendRun(Chars + RunStart, Length - RunStart);
+
+		Buffer.Add('"');
+	}
+
+	void AppendRun(const TCHAR* Chars, int32 Count);
+};
+
+template<>
+void TJsonLibraryTextWriter<TCHAR>::AppendRun(const TCHAR* Chars, int32 Count)
+{
+	if (Count > 0)
+	{
+		Buffer.Append(Chars, Count);
+	}
+}
+
+template<>
+void TJsonLibraryTextWriter<uint8>::AppendRun(const TCHAR* Chars, int32 Count)
+{
+	if (Count <= 0)
+	{
+		return;
+	}
+
+	bool bAscii = true;
+	for (int32 i = 0; i < Count && bAscii; ++i)
+	{
+		bAscii = Chars[i] < 0x80;
+	}
+
+	if (bAscii)
+	{
+		const int32 Offset = Buffer.AddUninitialized(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Buffer[Offset + i] = (uint8)Chars[i];
+		}
+	}
+	else
+	{
+		FTCHARToUTF8 Converter(Chars, Count);
+		Buffer.Append((const uint8*)Converter.Get(), Converter.Length());
+	}
+}
+
+/** Reads a JSON object from TCHAR or UTF-8 text straight into struct memory */
+template<typename CharType>
+class TJsonLibraryTextReader
+{
+public:
+
+	TJsonLibraryTextReader(const CharType* InText, int32 Length)
+		: Cursor(InText)
+		, End(InText + Length)
+	{
+	}
+
+	bool ReadRoot(const UStruct* StructDefinition, void* OutStruct, int64 CheckFlags, int64 SkipFlags)
+	{
+		SkipWhitespace();
+		if (!ReadStruct(StructDefinition, OutStruct, StructDefinition, OutStruct, CheckFlags, SkipFlags))
+		{
+			return false;
+		}
+
+		SkipWhitespace();
+		return Cursor == End;
+	}
+
+private:
+
+	const CharType* Cursor;
+	const CharType* End;
+
+	bool ReadStruct(const UStruct* StructDefinition, void* OutStruct, const UStruct* ContainerStruct, void* Container, int64 CheckFlags, int64 SkipFlags)
+	{
+		if (!Consume('{'))
+		{
+			return false;
+		}
+
+		SkipWhitespace();
+		if (Consume('}'))
+		{
+			return true;
+		}
+
+		FJsonLibraryConverterPlanPtr Plan = FJsonLibraryConverterPlanCache::Get().Find(StructDefinition, CheckFlags, SkipFlags);
+
+		FString Key;
+		do
+		{
+			SkipWhitespace();
+			if (!ReadString(Key))
+			{
+				return false;
+			}
+
+			SkipWhitespace();
+			if (!Consume(':'))
+			{
+				return false;
+			}
+			SkipWhitespace();
+
+			const int32* FieldIndex = Plan->FieldIndices.Find(Key);
+			if (!FieldIndex)
+			{
+				// keys that don't match a property are ignored, as with JsonAttributesToUStruct
+				TSharedPtr<FJsonValue> Ignored;
+				if (!ReadValue(Ignored))
+				{
+					return false;
+				}
+			}
+			else
+			{
+				const FJsonLibraryConverterField& Field = Plan->Fields[*FieldIndex];
+				if (!ReadProperty(Field.Property, Field.Kind, Field.Read, (uint8*)OutStruct + Field.Offset, ContainerStruct, Container, CheckFlags, SkipFlags))
+				{
+					UE_LOG(LogJson, Error, TEXT("JsonTextToUStruct - Unable to parse %s.%s from JSON"), *StructDefinition->GetName(), *Field.Property->GetName());
+					return false;
+				}
+			}
+
+			SkipWhitespace();
+		}
+		while (Consume(','));
+
+		return Consume('}');
+	}
+
+	bool ReadProperty(FProperty* Property, EPlannedKind Kind, FPlannedReadFunc Read, void* OutValue, const UStruct* ContainerStruct, void* Container, int64 CheckFlags, int64 SkipFlags)
+	{
+		if (Cursor >= End)
+		{
+			return false;
+		}
+
+		// null values leave the property untouched
+		const CharType Next = *Cursor;
+		if (Next == 'n')
+		{
+			return ConsumeLiteral("null");
+		}
+
+		const bool bNumber = Next == '-' || (Next >= '0' && Next <= '9');
+		switch (Kind)
+		{
+			case EPlannedKind::Bool:
+				if (Next == 't' || Next == 'f')
+				{
+					const bool bValue = Next == 't';
+					static_cast<const FBoolProperty*>(Property)->SetPropertyValue(OutValue, bValue);
+					return ConsumeLiteral(bValue ? "true" : "false");
+				}
+				break;
+			case EPlannedKind::Float:
+				if (bNumber)
+				{
+					return ReadNumber(*(float*)OutValue);
+				}
+				break;
+			case EPlannedKind::Double:
+				if (bNumber)
+				{
+					return ReadNumber(*(double*)OutValue);
+				}
+				break;
+			case EPlannedKind::Int32:
+			case EPlannedKind::Integer:
+				if (bNumber)
+				{
+					double Number;
+					if (!ReadNumber(Number))
+					{
+						return false;
+					}
+					static_cast<const FNumericProperty*>(Property)->SetIntPropertyValue(OutValue, (int64)Number);
+					return true;
+				}
+				break;
+			case EPlannedKind::String:
+				if (Next == '"')
+				{
+					return ReadString(*(FString*)OutValue);
+				}
+				break;
+			case EPlannedKind::Struct:
+				if (Next == '{')
+				{
+					return ReadStruct(static_cast<const FStructProperty*>(Property)->Struct, OutValue, ContainerStruct, Container, CheckFlags & (~CPF_ParmFlags), SkipFlags);
+				}
+				break;
+			case EPlannedKind::Array:
+				if (Next == '[')
+				{
+					return ReadArray(static_cast<FArrayProperty*>(Property), OutValue, ContainerStruct, Container, CheckFlags & (~CPF_ParmFlags), SkipFlags);
+				}
+				break;
+			default:
+				break;
+		}
+
+		// everything else goes through the DOM for this value only
+		TSharedPtr<FJsonValue> JsonValue;
+		if (!ReadValue(JsonValue))
+		{
+			return false;
+		}
+
+		if (Read && JsonValue->Type != EJson::Array)
+		{
+			Read(Property, *JsonValue, OutValue);
+			return true;
+		}
+
+		return JsonValueToFPropertyWithContainer(JsonValue, Property, OutValue, ContainerStruct, Container, CheckFlags, SkipFlags);
+	}
+
+	bool ReadArray(FArrayProperty* ArrayProperty, void* OutValue, const UStruct* ContainerStruct, void* Container, int64 CheckFlags, int64 SkipFlags)
+	{
+		if (!Consume('['))
+		{
+			return false;
+		}
+
+		FPlannedWriteFunc InnerWrite;
+		FPlannedReadFunc InnerRead;
+		const EPlannedKind InnerKind = MakePlannedThunks(ArrayProperty->Inner, InnerWrite, InnerRead);
+
+		FScriptArrayHelper Helper(ArrayProperty, OutValue);
+		Helper.EmptyValues();
+
+		SkipWhitespace();
+		if (Consume(']'))
+		{
+			return true;
+		}
+
+		do
+		{
+			SkipWhitespace();
+
+			const int32 Index = Helper.AddValue();
+			if (!ReadProperty(ArrayProperty->Inner, InnerKind, InnerRead, Helper.GetRawPtr(Index), ContainerStruct, Container, CheckFlags, SkipFlags))
+			{
+				UE_LOG(LogJson, Error, TEXT("JsonTextToUStruct - Unable to deserialize array element [%d] for property %s"), Index, *ArrayProperty->GetNameCPP());
+				return false;
+			}
+
+			SkipWhitespace();
+		}
+		while (Consume(','));
+
+		return Consume(']');
+	}
+
+	bool ReadValue(TSharedPtr<FJsonValue>& OutValue)
+	{
+		if (Cursor >= End)
+		{
+			return false;
+		}
+
+		switch (*Cursor)
+		{
+			case '{':
+			{
+				++Cursor;
+				TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+
+				SkipWhitespace();
+				if (!Consume('}'))
+				{
+					FString Key;
+					do
+					{
+						SkipWhitespace();
+						TSharedPtr<FJsonValue> Value;
+						if (!ReadString(Key))
+						{
+							return false;
+						}
+						SkipWhitespace();
+						if (!Consume(':'))
+						{
+							return false;
+						}
+						SkipWhitespace();
+						if (!ReadValue(Value))
+						{
+							return false;
+						}
+						Object->SetField(Key, Value);
+						SkipWhitespace();
+					}
+					while (Consume(','));
+
+					if (!Consume('}'))
+					{
+						return false;
+					}
+				}
+
+				OutValue = MakeShared<FJsonValueObject>(Object);
+				return true;
+			}
+			case '[':
+			{
+				++Cursor;
+				TArray<TSharedPtr<FJsonValue>> Array;
+
+				SkipWhitespace();
+				if (!Consume(']'))
+				{
+					do
+					{
+						SkipWhitespace();
+						TSharedPtr<FJsonValue>& Value = Array.AddDefaulted_GetRef();
+						if (!ReadValue(Value))
+						{
+							return false;
+						}
+						SkipWhitespace();
+					}
+					while (Consume(','));
+
+					if (!Consume(']'))
+					{
+						return false;
+					}
+				}
+
+				OutValue = MakeShared<FJsonValueArray>(Array);
+				return true;
+			}
+			case '"':
+			{
+				FString String;
+				if (!ReadString(String))
+				{
+					return false;
+				}
+				OutValue = MakeShared<FJsonValueString>(String);
+				return true;
+			}
+			case 't':
+				OutValue = MakeShared<FJsonValueBoolean>(true);
+				return ConsumeLiteral("true");
+			case 'f':
+				OutValue = MakeShared<FJsonValueBoolean>(false);
+				return ConsumeLiteral("false");
+			case 'n':
+				OutValue = MakeShared<FJsonValueNull>();
+				return ConsumeLiteral("null");
+			default:
+			{
+				double Number;
+				if (!ReadNumber(Number))
+				{
+					return false;
+				}
+				OutValue = MakeShared<FJsonValueNumber>(Number);
+				return true;
+			}
+		}
+	}
+
+	bool ReadNumber(float& OutNumber)
+	{
+		const auto* CodecCursor = AsCodecChars(Cursor);
+		if (!FJsonLibraryNumberCodec::ReadFloat(CodecCursor, AsCodecChars(End), OutNumber))
+		{
+			return false;
+		}
+		Cursor = (const CharType*)CodecCursor;
+		return true;
+	}
+
+	bool ReadNumber(double& OutNumber)
+	{
+		const auto* CodecCursor = AsCodecChars(Cursor);
+		if (!FJsonLibraryNumberCodec::ReadDouble(CodecCursor, AsCodecChars(End), OutNumber))
+		{
+			return false;
+		}
+		Cursor = (const CharType*)CodecCursor;
+		return true;
+	}
+
+	bool ReadString(FString& OutString)
+	{
+		if (!Consume('"'))
+		{
+			return false;
+		}
+
+		OutString.Reset();
+
+		const CharType* RunStart = Cursor;
+		while (Cursor < End)
+		{
+			const CharType Char = *Cursor;
+			if (Char == '"')
+			{
+				AppendRun(OutString, RunStart, (int32)(Cursor - RunStart));
+				++Cursor;
+				return true;
+			}
+
+			if (Char != '\\')
+			{
+				++Cursor;
+				continue;
+			}
+
+			AppendRun(OutString, RunStart, (int32)(Cursor - RunStart));
+			if (++Cursor >= End)
+			{
+				return false;
+			}
+
+			switch (*Cursor++)
+			{
+				case '"':  OutString.AppendChar(TEXT('"'));  break;
+				case '\\': OutString.AppendChar(TEXT('\\')); break;
+				case '/':  OutString.AppendChar(TEXT('/'));  break;
+				case 'b':  OutString.AppendChar(TEXT('\b')); break;
+				case 'f':  OutString.AppendChar(TEXT('\f')); break;
+				case 'n':  OutString.AppendChar(TEXT('\n')); break;
+				case 'r':  OutString.AppendChar(TEXT('\r')); break;
+				case 't':  OutString.AppendChar(TEXT('\t')); break;
+				case 'u':
+				{
+					if (End - Cursor < 4)
+					{
+						return false;
+					}
+
+					uint32 CodeUnit = 0;
+					for (int32 i = 0; i < 4; ++i)
+					{
+						const CharType Hex = *Cursor++;
+						CodeUnit <<= 4;
+						if (Hex >= '0' && Hex <= '9')
+						{
+							CodeUnit |= Hex - '0';
+						}
+						else if (Hex >= 'a' && Hex <= 'f')
+						{
+							CodeUnit |= Hex - 'a' + 10;
+						}
+						else if (Hex >= 'A' && Hex <= 'F')
+						{
+							CodeUnit |= Hex - 'A' + 10;
+						}
+						else
+						{
+							return false;
+						}
+					}
+
+					// surrogate pairs arrive as two escapes, which is what a UTF-16 TCHAR wants
+					OutString.AppendChar((TCHAR)CodeUnit);
+					break;
+				}
+				default:
+					return false;
+			}
+
+			RunStart = Cursor;
+		}
+
+		return false;
+	}
+
+	static void AppendRun(FString& OutString, const CharType* Chars, int32 Count);
+
+	FORCEINLINE void SkipWhitespace()
+	{
+		while (Cursor < End && (*Cursor == ' ' || *Cursor == '\n' || *Cursor == '\r' || *Cursor == '\t'))
+		{
+			++Cursor;
+		}
+	}
+
+	FORCEINLINE bool Consume(ANSICHAR Char)
+	{
+		if (Cursor < End && *Cursor == Char)
+		{
+			++Cursor;
+			return true;
+		}
+		return false;
+	}
+
+	bool ConsumeLiteral(const ANSICHAR* Literal)
+	{
+		while (*Literal)
+		{
+			if (!Consume(*Literal++))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+template<>
+void TJsonLibraryTextReader<TCHAR>::AppendRun(FString& OutString, const TCHAR* Chars, int32 Count)
+{
+	if (Count > 0)
+	{
+		OutString.AppendChars(Chars, Count);
+	}
+}
+
+template<>
+void TJsonLibraryTextReader<uint8>::AppendRun(FString& OutString, const uint8* Chars, int32 Count)
+{
+	if (Count > 0)
+	{
+		FUTF8ToTCHAR Converter((const ANSICHAR*)Chars, Count);
+		OutString.AppendChars(Converter.Get(), Converter.Length());
+	}
+}
+}
+
+bool FJsonLibraryConverter::UStructToJsonText(const UStruct* StructDefinition, const void* Struct, FString& OutJsonString, int64 CheckFlags, int64 SkipFlags)
+{
+	if (SkipFlags == 0)
+	{
+		// If we have no specified skip flags, skip deprecated, transient and skip serialization by default when writing
+		SkipFlags |= CPF_Deprecated | CPF_Transient;
+	}
+
+	TArray<TCHAR>& Buffer = OutJsonString.GetCharArray();
+	Buffer.Reset();
+
+	TJsonLibraryTextWriter<TCHAR> Writer(Buffer);
+	const bool bSuccess = Writer.WriteStruct(StructDefinition, Struct, CheckFlags, SkipFlags);
+	Buffer.Add(TEXT('\0'));
+
+	return bSuccess;
+}
+
+bool FJsonLibraryConverter::UStructToJsonText(const UStruct* StructDefinition, const void* Struct, TArray<uint8>& OutJsonUtf8, int64 CheckFlags, int64 SkipFlags)
+{
+	if (SkipFlags == 0)
+	{
+		// If we have no specified skip flags, skip deprecated, transient and skip serialization by default when writing
+		SkipFlags |= CPF_Deprecated | CPF_Transient;
+	}
+
+	OutJsonUtf8.Reset();
+
+	TJsonLibraryTextWriter<uint8> Writer(OutJsonUtf8);
+	return Writer.WriteStruct(StructDefinition, Struct, CheckFlags, SkipFlags);
+}
+
+bool FJsonLibraryConverter::JsonTextToUStruct(const TCHAR* JsonText, int32 Length, const UStruct* StructDefinition, void* OutStruct, int64 CheckFlags, int64 SkipFlags)
+{
+	TJsonLibraryTextReader<TCHAR> Reader(JsonText, Length);
+	return Reader.ReadRoot(StructDefinition, OutStruct, CheckFlags, SkipFlags);
+}
+
+bool FJsonLibraryConverter::JsonTextToUStruct(const FString& JsonString, const UStruct* StructDefinition, void* OutStruct, int64 CheckFlags, int64 SkipFlags)
+{
+	return JsonTextToUStruct(*JsonString, JsonString.Len(), StructDefinition, OutStruct, CheckFlags, SkipFlags);
+}
+
+bool FJsonLibraryConverter::JsonTextToUStruct(const uint8* JsonUtf8, int32 Length, const UStruct* StructDefinition, void* OutStruct, int64 CheckFlags, int64 SkipFlags)
+{
+	// skip a byte order mark
+	if (Length >= 3 && JsonUtf8[0] == 0xEF && JsonUtf8[1] == 0xBB && JsonUtf8[2] == 0xBF)
+	{
+		JsonUtf8 += 3;
+		Length -= 3;
+	}
+
+	TJsonLibraryTextReader<uint8> Reader(JsonUtf8, Length);
+	return Reader.ReadRoot(StructDefinition, OutStruct, CheckFlags, SkipFlags);
+}
@@ -0,0 +1,302 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibraryDocument.h"
+#include "JsonLibraryScanner.h"
+
+struct FJsonLibraryDocumentNode
+{
+	// Source text, shared by every node of a document.
+	TSharedPtr<const FString> Text;
+	int32 Start;
+	int32 End;
+	EJson Type;
+
+	// Direct children, indexed on first access.
+	bool bIndexed;
+	TArray<int32> ChildStarts;
+	TArray<int32> ChildEnds;
+	TArray<FString> Keys;
+	TMap<FString, int32> Fields;
+	TArray<TSharedPtr<FJsonLibraryDocumentNode>> Children;
+
+	// Built value, cached on first access.
+	TSharedPtr<FJsonValue> Value;
+
+	FJsonLibraryDocumentNode( const TSharedPtr<const FString>& InText, int32 InStart, int32 InEnd )
+	{
+		Text = InText;
+		Start = InStart;
+		End = InEnd;
+		Type = FJsonLibraryScanner( *Text ).GetType( Start );
+
+		bIndexed = false;
+	}
+
+	void Index()
+	{
+		if ( bIndexed )
+			return;
+
+		bIndexed = true;
+		if ( Type != EJson::Object && Type != EJson::Array )
+			return;
+
+		const FJsonLibraryScanner Scanner( *Text );
+		const TCHAR Close = Type == EJson::Object ? TCHAR( '}' ) : TCHAR( ']' );
+
+		int32 Pos = Start + 1;
+		Scanner.SkipWhitespace( Pos );
+		while ( Pos < End && Scanner.Text[ Pos ] != Close )
+		{
+			if ( Type == EJson::Object )
+			{
+				FString Key;
+				Scanner.ReadString( Pos, &Key );
+
+				Scanner.SkipWhitespace( Pos );
+				Pos++;
+				Scanner.SkipWhitespace( Pos );
+
+				// Later duplicates win, as in FJsonObject.
+				if ( int32* Field = Fields.Find( Key ) )
+					*Field = ChildStarts.Num();
+				else
+				{
+					Fields.Add( Key, ChildStarts.Num() );
+					Keys.Add( Key );
+				}
+			}
+
+			ChildStarts.Add( Pos );
+			Scanner.Skip( Pos, 0 );
+			ChildEnds.Add( Pos );
+
+			Scanner.SkipWhitespace( Pos );
+			if ( Scanner.Text[ Pos ] == TCHAR( ',' ) )
+			{
+				Pos++;
+				Scanner.SkipWhitespace( Pos );
+			}
+		}
+
+		Children.SetNum( ChildStarts.Num() );
+	}
+
+	TSharedPtr<FJsonLibraryDocumentNode> GetChild( int32 Index, const FString* Key )
+	{
+		if ( !Children.IsValidIndex( Index ) )
+			return TSharedPtr<FJsonLibraryDocumentNode>();
+
+		TSharedPtr<FJsonLibraryDocumentNode>& Child = Children[ Index ];
+		if ( Child.IsValid() )
+			return Child;
+
+		Child = MakeShareable( new FJsonLibraryDocumentNode( Text, ChildStarts[ Index ], ChildEnds[ Index ] ) );
+
+		// Share the built value with the parent, if it was built first.
+		if ( Value.IsValid() )
+		{
+			if ( Key && Type == EJson::Object )
+				Child->Value = Value->AsObject()->TryGetField( *Key );
+			else if ( Type == EJson::Array && Value->AsArray().IsValidIndex( Index ) )
+				Child->Value = Value->AsArray()[ Index ];
+		}
+
+		return Child;
+	}
+
+	const TSharedPtr<FJsonValue>& Build()
+	{
+		if ( !Value.IsValid() )
+		{
+			int32 Pos = Start;
+			Value = FJsonLibraryScanner( *Text ).Build( Pos );
+		}
+
+		return Value;
+	}
+};
+
+FJsonLibraryDocument::FJsonLibraryDocument()
+{
+}
+
+FJsonLibraryDocument FJsonLibraryDocument::Parse( const FString& Text )
+{
+	FJsonLibraryDocument Document;
+
+	TSharedPtr<const FString> SharedText = MakeShareable( new FString( Text ) );
+	const FJsonLibraryScanner Scanner( *SharedText );
+
+	int32 Pos = 0;
+	Scanner.SkipWhitespace( Pos );
+
+	const int32 Start = Pos;
+	if ( !Scanner.Skip( Pos, 0 ) )
+		return Document;
+
+	const int32 End = Pos;
+	Scanner.SkipWhitespace( Pos );
+	if ( Pos != Scanner.Length )
+		return Document;
+
+	Document.Node = MakeShareable( new FJsonLibraryDocumentNode( SharedText, Start, End ) );
+	return Document;
+}
+
+bool FJsonLibraryDocument::IsValid() const
+{
+	return Node.IsValid();
+}
+
+EJsonLibraryType FJsonLibraryDocument::GetType() const
+{
+	if ( !Node.IsValid() )
+		return EJsonLibraryType::Invalid;
+
+	switch ( Node->Type )
+	{
+		case EJson::Null:    return EJsonLibraryType::Null;
+		case EJson::Boolean: return EJsonLibraryType::Boolean;
+		case EJson::Number:  return EJsonLibraryType::Number;
+		case EJson::String:  return EJsonLibraryType::String;
+		case EJson::Object:  return EJsonLibraryType::Object;
+		case EJson::Array:   return EJsonLibraryType::Array;
+	}
+
+	return EJsonLibraryType::Invalid;
+}
+
+int32 FJsonLibraryDocument::Count() const
+{
+	if ( !Node.IsValid() )
+		return 0;
+
+	Node->Index();
+	return Node->Type == EJson::Object ? Node->Fields.Num() : Node->ChildStarts.Num();
+}
+
+bool FJsonLibraryDocument::HasKey( const FString& Key ) const
+{
+	if ( !Node.IsValid() || Node->Type != EJson::Object )
+		return false;
+
+	Node->Index();
+	return Node->Fields.Contains( Key );
+}
+
+TArray<FString> FJsonLibraryDocument::GetKeys() const
+{
+	if ( !Node.IsValid() || Node->Type != EJson::Object )
+		return TArray<FString>();
+
+	Node->Index();
+	return Node->Keys;
+}
+
+FJsonLibraryDocument FJsonLibraryDocument::GetField( const FString& Key ) const
+{
+	FJsonLibraryDocument Document;
+	if ( !Node.IsValid() || Node->Type != EJson::Object )
+		return Document;
+
+	Node->Index();
+
+	const int32* Field = Node->Fields.Find( Key );
+	if ( Field )
+		Document.Node = Node->GetChild( *Field, &Key );
+
+	return Document;
+}
+
+FJsonLibraryDocument FJsonLibraryDocument::GetItem( int32 Index ) const
+{
+	FJsonLibraryDocument Document;
+	if ( !Node.IsValid() || Node->Type != EJson::Array )
+		return Document;
+
+	Node->Index();
+	Document.Node = Node->GetChild( Index, nullptr );
+
+	return Document;
+}
+
+bool FJsonLibraryDocument::GetBoolean() const
+{
+	if ( !Node.IsValid() )
+		return false;
+
+	if ( Node->Type == EJson::Boolean )
+		return ( *Node->Text )[ Node->Start ] == TCHAR( 't' );
+
+	return GetValue().GetBoolean();
+}
+
+float FJsonLibraryDocument::GetFloat() const
+{
+	return (float)GetNumber();
+}
+
+int32 FJsonLibraryDocument::GetInteger() const
+{
+	return (int32)GetNumber();
+}
+
+double FJsonLibraryDocument::GetNumber() const
+{
+	if ( !Node.IsValid() )
+		return 0.0;
+
+	if ( Node->Type == EJson::Number )
+	{
+		int32 Pos = Node->Start;
+
+		double Value = 0.0;
+		FJsonLibraryScanner( *Node->Text ).ReadNumber( Pos, Value );
+		return Value;
+	}
+
+	return GetValue().GetNumber();
+}
+
+FString FJsonLibraryDocument::GetString() const
+{
+	if ( !Node.IsValid() )
+		return FString();
+
+	if ( Node->Type == EJson::String )
+	{
+		int32 Pos = Node->Start;
+
+		FString Value;
+		FJsonLibraryScanner( *Node->Text ).ReadString( Pos, &Value );
+		return Value;
+	}
+
+	return GetValue().GetString();
+}
+
+FJsonLibraryValue FJsonLibraryDocument::GetValue() const
+{
+	if ( !Node.IsValid() )
+		return FJsonLibraryValue( TSharedPtr<FJsonValue>() );
+
+	return FJsonLibraryValue( Node->Build() );
+}
+
+FJsonLibraryObject FJsonLibraryDocument::GetObject() const
+{
+	return GetValue().GetObject();
+}
+
+FJsonLibraryList FJsonLibraryDocument::GetList() const
+{
+	return GetValue().GetList();
+}
+
+FString FJsonLibraryDocument::Stringify() const
+{
+	if ( !Node.IsValid() )
+		return FString();
+
+	return Node->Text->Mid( Node->Start, Node->End - Node->Start );
+}
@@ -0,0 +1,249 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibraryFrozen.h"
+
+struct FJsonLibraryFrozenRoot
+{
+	TSharedPtr<FJsonValue> JsonValue;
+};
+
+namespace JsonLibraryFrozen
+{
+	// Copy every node, scalars included, so no reference count is shared across threads.
+	TSharedPtr<FJsonValue> Copy( const FJsonValue* Value )
+	{
+		if ( !Value )
+			return TSharedPtr<FJsonValue>();
+
+		switch ( Value->Type )
+		{
+			case EJson::Null:    return MakeShareable( new FJsonValueNull() );
+			case EJson::Boolean: return MakeShareable( new FJsonValueBoolean( Value->AsBool() ) );
+			case EJson::Number:  return MakeShareable( new FJsonValueNumber( Value->AsNumber() ) );
+			case EJson::String:  return MakeShareable( new FJsonValueString( Value->AsString() ) );
+			case EJson::Array:
+			{
+				const TArray<TSharedPtr<FJsonValue>>& Array = Value->AsArray();
+
+				TArray<TSharedPtr<FJsonValue>> Items;
+				Items.Reserve( Array.Num() );
+				for ( const TSharedPtr<FJsonValue>& Item : Array )
+					Items.Add( Copy( Item.Get() ) );
+
+				return MakeShareable( new FJsonValueArray( Items ) );
+			}
+			case EJson::Object:
+			{
+				TSharedPtr<FJsonObject> Object = MakeShareable( new FJsonObject() );
+
+				const TSharedPtr<FJsonObject>& Source = Value->AsObject();
+				if ( Source.IsValid() )
+				{
+					Object->Values.Reserve( Source->Values.Num() );
+					for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : Source->Values )
+						Object->Values.Add( Temp.Key, Copy( Temp.Value.Get() ) );
+				}
+
+				return MakeShareable( new FJsonValueObject( Object ) );
+			}
+		}
+
+		return TSharedPtr<FJsonValue>();
+	}
+
+	const FJsonObject* GetObject( const FJsonValue* Value )
+	{
+		if ( !Value || Value->Type != EJson::Object )
+			return nullptr;
+
+		return Value->AsObject().Get();
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* GetArray( const FJsonValue* Value )
+	{
+		if ( !Value || Value->Type != EJson::Array )
+			return nullptr;
+
+		return &Value->AsArray();
+	}
+}
+
+FJsonLibraryFrozen::FJsonLibraryFrozen()
+{
+	JsonValue = nullptr;
+}
+
+FJsonLibraryFrozen::FJsonLibraryFrozen( const TSharedPtr<const FJsonLibraryFrozenRoot, ESPMode::ThreadSafe>& InRoot, const FJsonValue* InJsonValue )
+{
+	Root = InRoot;
+	JsonValue = InJsonValue;
+}
+
+FJsonLibraryFrozen FJsonLibraryFrozen::Freeze( const FJsonLibraryValue& Value )
+{
+	TSharedPtr<FJsonValue> Copy = JsonLibraryFrozen::Copy( Value.JsonValue.Get() );
+	if ( !Copy.IsValid() )
+		return FJsonLibraryFrozen();
+
+	TSharedPtr<FJsonLibraryFrozenRoot, ESPMode::ThreadSafe> NewRoot = MakeShareable( new FJsonLibraryFrozenRoot() );
+	NewRoot->JsonValue = Copy;
+
+	return FJsonLibraryFrozen( NewRoot, Copy.Get() );
+}
+
+FJsonLibraryFrozen FJsonLibraryFrozen::Parse( const FString& Text )
+{
+	// a freshly parsed tree has no other owners, so it is frozen as is
+	FJsonLibraryValue Value = FJsonLibraryValue::Parse( Text );
+	if ( !Value.JsonValue.IsValid() )
+		return FJsonLibraryFrozen();
+
+	TSharedPtr<FJsonLibraryFrozenRoot, ESPMode::ThreadSafe> NewRoot = MakeShareable( new FJsonLibraryFrozenRoot() );
+	NewRoot->JsonValue = MoveTemp( Value.JsonValue );
+
+	return FJsonLibraryFrozen( NewRoot, NewRoot->JsonValue.Get() );
+}
+
+FJsonLibraryValue FJsonLibraryFrozen::Thaw() const
+{
+	return FJsonLibraryValue( JsonLibraryFrozen::Copy( JsonValue ) );
+}
+
+bool FJsonLibraryFrozen::IsValid() const
+{
+	return JsonValue != nullptr;
+}
+
+EJsonLibraryType FJsonLibraryFrozen::GetType() const
+{
+	if ( !JsonValue )
+		return EJsonLibraryType::Invalid;
+
+	switch ( JsonValue->Type )
+	{
+		case EJson::Null:    return EJsonLibraryType::Null;
+		case EJson::Boolean: return EJsonLibraryType::Boolean;
+		case EJson::Number:  return EJsonLibraryType::Number;
+		case EJson::String:  return EJsonLibraryType::String;
+		case EJson::Object:  return EJsonLibraryType::Object;
+		case EJson::Array:   return EJsonLibraryType::Array;
+	}
+
+	return EJsonLibraryType::Invalid;
+}
+
+int32 FJsonLibraryFrozen::Count() const
+{
+	if ( const FJsonObject* Object = JsonLibraryFrozen::GetObject( JsonValue ) )
+		return Object->Values.Num();
+	if ( const TArray<TSharedPtr<FJsonValue>>* Array = JsonLibraryFrozen::GetArray( JsonValue ) )
+		return Array->Num();
+
+	return 0;
+}
+
+bool FJsonLibraryFrozen::HasKey( const FString& Key ) const
+{
+	const FJsonObject* Object = JsonLibraryFrozen::GetObject( JsonValue );
+	if ( !Object )
+		return false;
+
+	return Object->Values.Contains( Key );
+}
+
+TArray<FString> FJsonLibraryFrozen::GetKeys() const
+{
+	TArray<FString> Keys;
+
+	const FJsonObject* Object = JsonLibraryFrozen::GetObject( JsonValue );
+	if ( Object )
+		Object->Values.GetKeys( Keys );
+
+	return Keys;
+}
+
+FJsonLibraryFrozen FJsonLibraryFrozen::GetField( const FString& Key ) const
+{
+	const FJsonObject* Object = JsonLibraryFrozen::GetObject( JsonValue );
+	if ( !Object )
+		return FJsonLibraryFrozen();
+
+	const TSharedPtr<FJsonValue>* Field = Object->Values.Find( Key );
+	if ( !Field || !Field->IsValid() )
+		return FJsonLibraryFrozen();
+
+	return FJsonLibraryFrozen( Root, Field->Get() );
+}
+
+FJsonLibraryFrozen FJsonLibraryFrozen::GetItem( int32 Index ) const
+{
+	const TArray<TSharedPtr<FJsonValue>>* Array = JsonLibraryFrozen::GetArray( JsonValue );
+	if ( !Array || !Array->IsValidIndex( Index ) || !( *Array )[ Index ].IsValid() )
+		return FJsonLibraryFrozen();
+
+	return FJsonLibraryFrozen( Root, ( *Array )[ Index ].Get() );
+}
+
+bool FJsonLibraryFrozen::GetBoolean() const
+{
+	if ( !JsonValue )
+		return false;
+
+	switch ( JsonValue->Type )
+	{
+		case EJson::Boolean: return JsonValue->AsBool();
+		case EJson::Number:  return JsonValue->AsNumber() != 0.0;
+		case EJson::String:  return JsonValue->AsString().ToBool();
+	}
+
+	return false;
+}
+
+float FJsonLibraryFrozen::GetFloat() const
+{
+	return (float)GetNumber();
+}
+
+int32 FJsonLibraryFrozen::GetInteger() const
+{
+	return (int32)GetNumber();
+}
+
+double FJsonLibraryFrozen::GetNumber() const
+{
+	if ( !JsonValue )
+		return 0.0;
+
+	switch ( JsonValue->Type )
+	{
+		case EJson::Boolean: return JsonValue->AsBool() ? 1.0 : 0.0;
+		case EJson::Number:  return JsonValue->AsNumber();
+		case EJson::String:
+		{
+			const FString Value = JsonValue->AsString();
+			return Value.IsNumeric() ? FCString::Atod( *Value ) : 0.0;
+		}
+	}
+
+	return 0.0;
+}
+
+FString FJsonLibraryFrozen::GetString() const
+{
+	if ( !JsonValue )
+		return FString();
+
+	switch ( JsonValue->Type )
+	{
+		case EJson::Boolean: return JsonValue->AsBool() ? TEXT( "true" ) : TEXT( "false" );
+		case EJson::Number:  return FString::SanitizeFloat( JsonValue->AsNumber(), 0 );
+		case EJson::String:  return JsonValue->AsString();
+	}
+
+	return FString();
+}
+
+FString FJsonLibraryFrozen::Stringify( bool bCondensed /*= true*/ ) const
+{
+	// the serializer takes shared references, so it works on a private copy
+	return Thaw().Stringify( bCondensed );
+}
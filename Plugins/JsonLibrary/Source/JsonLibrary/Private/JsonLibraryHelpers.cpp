@@ -19,6 +19,16 @@ FJsonLibraryList UJsonLibraryHelpers::ParseList( const FString& Text, const FJso
 	return FJsonLibraryList::Parse( Text, Notify );
 }
 
+FJsonLibraryValue UJsonLibraryHelpers::ParseCbor( const TArray<uint8>& Data )
+{
+	return FJsonLibraryValue::ParseCbor( Data );
+}
+
+FJsonLibraryDocument UJsonLibraryHelpers::ParseDocument( const FString& Text )
+{
+	return FJsonLibraryDocument::Parse( Text );
+}
+
 FJsonLibraryValue UJsonLibraryHelpers::ConstructNull()
 {
 	return FJsonLibraryValue();
@@ -29,6 +39,11 @@ FJsonLibraryObject UJsonLibraryHelpers::ConstructObject( const FJsonLibraryObjec
 	return FJsonLibraryObject( Notify );
 }
 
+FJsonLibraryObject UJsonLibraryHelpers::ConstructBatchedObject( const FJsonLibraryObjectBatchNotify& Notify )
+{
+	return FJsonLibraryObject( Notify );
+}
+
 FJsonLibraryList UJsonLibraryHelpers::ConstructList( const FJsonLibraryListNotify& Notify )
 {
 	return FJsonLibraryList( Notify );
@@ -549,6 +564,26 @@ FJsonLibraryList UJsonLibraryHelpers::ConvertFloatArrayToList( const TArray<floa
 	return FJsonLibraryList( Value );
 }
 
+bool UJsonLibraryHelpers::ParseFloatArray( const FString& Text, TArray<float>& Value )
+{
+	return FJsonLibraryList::ParseFloatArray( Text, Value );
+}
+
+FString UJsonLibraryHelpers::StringifyFloatArray( const TArray<float>& Value )
+{
+	return FJsonLibraryList::StringifyFloatArray( Value );
+}
+
+bool UJsonLibraryHelpers::ParseCborFloatArray( const TArray<uint8>& Data, TArray<float>& Value )
+{
+	return FJsonLibraryList::ParseCborFloatArray( Data, Value );
+}
+
+TArray<uint8> UJsonLibraryHelpers::EncodeCborFloatArray( const TArray<float>& Value )
+{
+	return FJsonLibraryList::EncodeCborFloatArray( Value );
+}
+
 FJsonLibraryList UJsonLibraryHelpers::ConvertIntegerArrayToList( const TArray<int32>& Value )
 {
 	return FJsonLibraryList( Value );
@@ -610,6 +645,11 @@ bool UJsonLibraryHelpers::JsonValue_Equals( const FJsonLibraryValue& Target, con
 	return Target.Equals( Value );
 }
 
+int32 UJsonLibraryHelpers::JsonValue_GetHash( const FJsonLibraryValue& Target )
+{
+	return (int32)Target.GetHash();
+}
+
 bool UJsonLibraryHelpers::JsonValue_IsValid( const FJsonLibraryValue& Target )
 {
 	return Target.IsValid();
@@ -640,6 +680,11 @@ FString UJsonLibraryHelpers::JsonValue_Stringify( const FJsonLibraryValue& Targe
 	return Target.Stringify( bCondensed );
 }
 
+TArray<uint8> UJsonLibraryHelpers::JsonValue_EncodeCbor( const FJsonLibraryValue& Target, bool bTypedArrays /*= true*/ )
+{
+	return Target.EncodeCbor( bTypedArrays );
+}
+
 
 bool UJsonLibraryHelpers::JsonObject_Equals( const FJsonLibraryObject& Target, const FJsonLibraryObject& Object )
 {
@@ -668,6 +713,18 @@ FJsonLibraryObject& UJsonLibraryHelpers::JsonObject_RemoveKey( FJsonLibraryObjec
 	return Target;
 }
 
+FJsonLibraryObject& UJsonLibraryHelpers::JsonObject_BeginNotifyBatch( FJsonLibraryObject& Target )
+{
+	Target.BeginNotifyBatch();
+	return Target;
+}
+
+FJsonLibraryObject& UJsonLibraryHelpers::JsonObject_EndNotifyBatch( FJsonLibraryObject& Target )
+{
+	Target.EndNotifyBatch();
+	return Target;
+}
+
 FJsonLibraryObject& UJsonLibraryHelpers::JsonObject_Add( FJsonLibraryObject& Target, const FJsonLibraryObject& Object )
 {
 	Target.Add( Object );
@@ -956,6 +1013,31 @@ FString UJsonLibraryHelpers::JsonObject_Stringify( const FJsonLibraryObject& Tar
 	return Target.Stringify( bCondensed );
 }
 
+TArray<uint8> UJsonLibraryHelpers::JsonObject_EncodeCbor( const FJsonLibraryObject& Target, bool bTypedArrays /*= true*/ )
+{
+	return Target.EncodeCbor( bTypedArrays );
+}
+
+FJsonLibraryList UJsonLibraryHelpers::JsonObject_CreatePatch( const FJsonLibraryObject& Target, const FJsonLibraryObject& Object )
+{
+	return Target.CreatePatch( Object );
+}
+
+bool UJsonLibraryHelpers::JsonObject_ApplyPatch( FJsonLibraryObject& Target, const FJsonLibraryList& Patch )
+{
+	return Target.ApplyPatch( Patch );
+}
+
+FJsonLibraryObject UJsonLibraryHelpers::JsonObject_CreateMergePatch( const FJsonLibraryObject& Target, const FJsonLibraryObject& Object )
+{
+	return Target.CreateMergePatch( Object );
+}
+
+bool UJsonLibraryHelpers::JsonObject_ApplyMergePatch( FJsonLibraryObject& Target, const FJsonLibraryObject& Patch )
+{
+	return Target.ApplyMergePatch( Patch );
+}
+
 
 bool UJsonLibraryHelpers::JsonList_Equals( const FJsonLibraryList& Target, const FJsonLibraryList& List )
 {
@@ -1663,6 +1745,17 @@ int32 UJsonLibraryHelpers::JsonList_FindList( const FJsonLibraryList& Target, co
 	return Target.FindList( Value, Index );
 }
 
+FJsonLibraryList& UJsonLibraryHelpers::JsonList_SetIndexed( FJsonLibraryList& Target, bool bIndexed )
+{
+	Target.SetIndexed( bIndexed );
+	return Target;
+}
+
+bool UJsonLibraryHelpers::JsonList_IsIndexed( const FJsonLibraryList& Target )
+{
+	return Target.IsIndexed();
+}
+
 bool UJsonLibraryHelpers::JsonList_IsValid( const FJsonLibraryList& Target )
 {
 	return Target.IsValid();
@@ -1678,6 +1771,221 @@ FString UJsonLibraryHelpers::JsonList_Stringify( const FJsonLibraryList& Target,
 	return Target.Stringify( bCondensed );
 }
 
+TArray<uint8> UJsonLibraryHelpers::JsonList_EncodeCbor( const FJsonLibraryList& Target, bool bTypedArrays /*= true*/ )
+{
+	return Target.EncodeCbor( bTypedArrays );
+}
+
+bool UJsonLibraryHelpers::JsonDocument_IsValid( const FJsonLibraryDocument& Target )
+{
+	return Target.IsValid();
+}
+
+EJsonLibraryType UJsonLibraryHelpers::JsonDocument_GetType( const FJsonLibraryDocument& Target )
+{
+	return Target.GetType();
+}
+
+int32 UJsonLibraryHelpers::JsonDocument_Count( const FJsonLibraryDocument& Target )
+{
+	return Target.Count();
+}
+
+bool UJsonLibraryHelpers::JsonDocument_HasKey( const FJsonLibraryDocument& Target, const FString& Key )
+{
+	return Target.HasKey( Key );
+}
+
+TArray<FString> UJsonLibraryHelpers::JsonDocument_GetKeys( const FJsonLibraryDocument& Target )
+{
+	return Target.GetKeys();
+}
+
+FJsonLibraryDocument UJsonLibraryHelpers::JsonDocument_GetField( const FJsonLibraryDocument& Target, const FString& Key )
+{
+	return Target.GetField( Key );
+}
+
+FJsonLibraryDocument UJsonLibraryHelpers::JsonDocument_GetItem( const FJsonLibraryDocument& Target, int32 Index )
+{
+	return Target.GetItem( Index );
+}
+
+bool UJsonLibraryHelpers::JsonDocument_GetBoolean( const FJsonLibraryDocument& Target )
+{
+	return Target.GetBoolean();
+}
+
+float UJsonLibraryHelpers::JsonDocument_GetFloat( const FJsonLibraryDocument& Target )
+{
+	return Target.GetFloat();
+}
+
+int32 UJsonLibraryHelpers::JsonDocument_GetInteger( const FJsonLibraryDocument& Target )
+{
+	return Target.GetInteger();
+}
+
+FString UJsonLibraryHelpers::JsonDocument_GetString( const FJsonLibraryDocument& Target )
+{
+	return Target.GetString();
+}
+
+FJsonLibraryValue UJsonLibraryHelpers::JsonDocument_GetValue( const FJsonLibraryDocument& Target )
+{
+	return Target.GetValue();
+}
+
+FJsonLibraryObject UJsonLibraryHelpers::JsonDocument_GetObject( const FJsonLibraryDocument& Target )
+{
+	return Target.GetObject();
+}
+
+FJsonLibraryList UJsonLibraryHelpers::JsonDocument_GetList( const FJsonLibraryDocument& Target )
+{
+	return Target.GetList();
+}
+
+FString UJsonLibraryHelpers::JsonDocument_Stringify( const FJsonLibraryDocument& Target )
+{
+	return Target.Stringify();
+}
+
+FJsonLibraryFrozen UJsonLibraryHelpers::JsonFrozen_Freeze( const FJsonLibraryValue& Value )
+{
+	return FJsonLibraryFrozen::Freeze( Value );
+}
+
+FJsonLibraryValue UJsonLibraryHelpers::JsonFrozen_Thaw( const FJsonLibraryFrozen& Target )
+{
+	return Target.Thaw();
+}
+
+bool UJsonLibraryHelpers::JsonFrozen_IsValid( const FJsonLibraryFrozen& Target )
+{
+	return Target.IsValid();
+}
+
+EJsonLibraryType UJsonLibraryHelpers::JsonFrozen_GetType( const FJsonLibraryFrozen& Target )
+{
+	return Target.GetType();
+}
+
+int32 UJsonLibraryHelpers::JsonFrozen_Count( const FJsonLibraryFrozen& Target )
+{
+	return Target.Count();
+}
+
+bool UJsonLibraryHelpers::JsonFrozen_HasKey( const FJsonLibraryFrozen& Target, const FString& Key )
+{
+	return Target.HasKey( Key );
+}
+
+TArray<FString> UJsonLibraryHelpers::JsonFrozen_GetKeys( const FJsonLibraryFrozen& Target )
+{
+	return Target.GetKeys();
+}
+
+FJsonLibraryFrozen UJsonLibraryHelpers::JsonFrozen_GetField( const FJsonLibraryFrozen& Target, const FString& Key )
+{
+	return Target.GetField( Key );
+}
+
+FJsonLibraryFrozen UJsonLibraryHelpers::JsonFrozen_GetItem( const FJsonLibraryFrozen& Target, int32 Index )
+{
+	return Target.GetItem( Index );
+}
+
+bool UJsonLibraryHelpers::JsonFrozen_GetBoolean( const FJsonLibraryFrozen& Target )
+{
+	return Target.GetBoolean();
+}
+
+float UJsonLibraryHelpers::JsonFrozen_GetFloat( const FJsonLibraryFrozen& Target )
+{
+	return Target.GetFloat();
+}
+
+int32 UJsonLibraryHelpers::JsonFrozen_GetInteger( const FJsonLibraryFrozen& Target )
+{
+	return Target.GetInteger();
+}
+
+FString UJsonLibraryHelpers::JsonFrozen_GetString( const FJsonLibraryFrozen& Target )
+{
+	return Target.GetString();
+}
+
+FString UJsonLibraryHelpers::JsonFrozen_Stringify( const FJsonLibraryFrozen& Target, bool bCondensed )
+{
+	return Target.Stringify( bCondensed );
+}
+
+FJsonLibrarySchema UJsonLibraryHelpers::JsonSchema_Compile( const FString& Schema )
+{
+	return FJsonLibrarySchema::Compile( Schema );
+}
+
+bool UJsonLibraryHelpers::JsonSchema_IsValid( const FJsonLibrarySchema& Target )
+{
+	return Target.IsValid();
+}
+
+bool UJsonLibraryHelpers::JsonSchema_Validate( const FJsonLibrarySchema& Target, const FString& Text, FString& Error )
+{
+	return Target.Validate( Text, Error );
+}
+
+bool UJsonLibraryHelpers::JsonSchema_ValidateValue( const FJsonLibrarySchema& Target, const FJsonLibraryValue& Value, FString& Error )
+{
+	return Target.ValidateValue( Value, Error );
+}
+
+FJsonLibraryQuery UJsonLibraryHelpers::JsonQuery_Compile( const FString& Query )
+{
+	return FJsonLibraryQuery::Compile( Query );
+}
+
+bool UJsonLibraryHelpers::JsonQuery_IsValid( const FJsonLibraryQuery& Target )
+{
+	return Target.IsValid();
+}
+
+FJsonLibraryValue UJsonLibraryHelpers::JsonQuery_Find( const FJsonLibraryQuery& Target, const FJsonLibraryValue& Value )
+{
+	return Target.Find( Value );
+}
+
+TArray<FJsonLibraryValue> UJsonLibraryHelpers::JsonQuery_FindAll( const FJsonLibraryQuery& Target, const FJsonLibraryValue& Value )
+{
+	return Target.FindAll( Value );
+}
+
+TArray<FJsonLibraryValue> UJsonLibraryHelpers::JsonQuery_ExtractArray( const FJsonLibraryQuery& Target, const FJsonLibraryList& List )
+{
+	return Target.ExtractArray( List );
+}
+
+TArray<bool> UJsonLibraryHelpers::JsonQuery_ExtractBooleanArray( const FJsonLibraryQuery& Target, const FJsonLibraryList& List )
+{
+	return Target.ExtractBooleanArray( List );
+}
+
+TArray<float> UJsonLibraryHelpers::JsonQuery_ExtractFloatArray( const FJsonLibraryQuery& Target, const FJsonLibraryList& List )
+{
+	return Target.ExtractFloatArray( List );
+}
+
+TArray<int32> UJsonLibraryHelpers::JsonQuery_ExtractIntegerArray( const FJsonLibraryQuery& Target, const FJsonLibraryList& List )
+{
+	return Target.ExtractIntegerArray( List );
+}
+
+TArray<FString> UJsonLibraryHelpers::JsonQuery_ExtractStringArray( const FJsonLibraryQuery& Target, const FJsonLibraryList& List )
+{
+	return Target.ExtractStringArray( List );
+}
+
 FString UJsonLibraryHelpers::StripCommentsOrCommas( const FString& Text, bool bComments /*= true*/, bool bTrailingCommas /*= true*/ )
 {
 	if ( !bComments && !bTrailingCommas )
@@ -0,0 +1,192 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibraryIndex.h"
+#include "JsonLibraryPatch.h"
+
+FThreadSafeCounter64 FJsonLibraryIndex::Edits;
+
+FJsonLibraryIndex::FJsonLibraryIndex()
+{
+	Generation = -1;
+	Source = nullptr;
+}
+
+uint32 FJsonLibraryIndex::Hash( const TSharedPtr<FJsonValue>& Value )
+{
+	if ( FJsonLibraryPatch::IsNull( Value ) )
+		return 0;
+
+	switch ( Value->Type )
+	{
+		case EJson::Boolean:
+			return HashCombine( (uint32)EJson::Boolean, Value->AsBool() ? 1 : 0 );
+		case EJson::Number:
+		{
+			// Negative zero equals zero.
+			double Number = Value->AsNumber();
+			if ( Number == 0.0 )
+				Number = 0.0;
+
+			return HashCombine( (uint32)EJson::Number, GetTypeHash( Number ) );
+		}
+		case EJson::String:
+			return HashCombine( (uint32)EJson::String, FCrc::StrCrc32( *Value->AsString() ) );
+		case EJson::Array:
+		{
+			uint32 Result = (uint32)EJson::Array;
+			for ( const TSharedPtr<FJsonValue>& Item : Value->AsArray() )
+				Result = HashCombine( Result, Hash( Item ) );
+
+			return Result;
+		}
+		case EJson::Object:
+		{
+			// Members have no order, so their hashes are summed.
+			uint32 Result = 0;
+
+			const TSharedPtr<FJsonObject>& Object = Value->AsObject();
+			if ( Object.IsValid() )
+			{
+				for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : Object->Values )
+					Result += HashCombine( GetTypeHash( Temp.Key ), Hash( Temp.Value ) );
+			}
+
+			return HashCombine( (uint32)EJson::Object, Result );
+		}
+	}
+
+	return 0;
+}
+
+void FJsonLibraryIndex::Touch( FJsonLibraryIndex* Index /*= nullptr*/ )
+{
+	const int64 Previous = Edits.Increment() - 1;
+
+	// The handle making the edit updates its own index, unless it had already missed another edit.
+	if ( Index && Index->Generation == Previous )
+		Index->Generation = Previous + 1;
+}
+
+bool FJsonLibraryIndex::IsCurrent() const
+{
+	return Generation == Edits.GetValue();
+}
+
+void FJsonLibraryIndex::Build( const TArray<TSharedPtr<FJsonValue>>& Items )
+{
+	Generation = Edits.GetValue();
+	Source = &Items;
+
+	Hashes.SetNumUninitialized( Items.Num() );
+	Positions.Reset();
+
+	for ( int32 i = 0; i < Items.Num(); i++ )
+	{
+		Hashes[ i ] = Hash( Items[ i ] );
+		Positions.Add( Hashes[ i ], i );
+	}
+}
+
+void FJsonLibraryIndex::Insert( const TArray<TSharedPtr<FJsonValue>>& Items, int32 Index, int32 Count /*= 1*/ )
+{
+	// A stale index is rebuilt on the next lookup instead.
+	if ( !IsCurrent() )
+		return;
+
+	if ( Index < 0 || Index > Hashes.Num() || Hashes.Num() + Count != Items.Num() )
+	{
+		Build( Items );
+		return;
+	}
+
+	if ( Index < Hashes.Num() )
+		Shift( Index, Count );
+
+	Hashes.InsertUninitialized( Index, Count );
+
+	for ( int32 i = Index; i < Index + Count; i++ )
+	{
+		Hashes[ i ] = Hash( Items[ i ] );
+		Positions.Add( Hashes[ i ], i );
+	}
+}
+
+void FJsonLibraryIndex::Set( const TArray<TSharedPtr<FJsonValue>>& Items, int32 Index )
+{
+	if ( !IsCurrent() )
+		return;
+
+	if ( !Hashes.IsValidIndex( Index ) || Hashes.Num() != Items.Num() )
+	{
+		Build( Items );
+		return;
+	}
+
+	const uint32 ItemHash = Hash( Items[ Index ] );
+	if ( ItemHash == Hashes[ Index ] )
+		return;
+
+	Positions.RemoveSingle( Hashes[ Index ], Index );
+	Positions.Add( ItemHash, Index );
+	Hashes[ Index ] = ItemHash;
+}
+
+void FJsonLibraryIndex::Remove( int32 Index )
+{
+	if ( !IsCurrent() || !Hashes.IsValidIndex( Index ) )
+		return;
+
+	Positions.RemoveSingle( Hashes[ Index ], Index );
+	if ( Index < Hashes.Num() - 1 )
+		Shift( Index + 1, -1 );
+
+	Hashes.RemoveAt( Index );
+}
+
+int32 FJsonLibraryIndex::Find( const TArray<TSharedPtr<FJsonValue>>& Items, const TSharedPtr<FJsonValue>& Value, int32 Index /*= 0*/ )
+{
+	Prepare( Items );
+
+	int32 Result = -1;
+	for ( TMultiMap<uint32, int32>::TConstKeyIterator It( Positions, Hash( Value ) ); It; ++It )
+	{
+		const int32 i = It.Value();
+		if ( i < Index || ( Result >= 0 && i > Result ) )
+			continue;
+
+		if ( FJsonLibraryPatch::DeepEquals( Items[ i ], Value ) )
+			Result = i;
+	}
+
+	return Result;
+}
+
+void FJsonLibraryIndex::FindAll( const TArray<TSharedPtr<FJsonValue>>& Items, const TSharedPtr<FJsonValue>& Value, TArray<int32>& Indices )
+{
+	Prepare( Items );
+
+	Indices.Reset();
+	for ( TMultiMap<uint32, int32>::TConstKeyIterator It( Positions, Hash( Value ) ); It; ++It )
+	{
+		const int32 i = It.Value();
+		if ( FJsonLibraryPatch::DeepEquals( Items[ i ], Value ) )
+			Indices.Add( i );
+	}
+
+	Indices.Sort();
+}
+
+void FJsonLibraryIndex::Shift( int32 Index, int32 Count )
+{
+	// Positions are moved in place; nothing is rehashed.
+	for ( TPair<uint32, int32>& Temp : Positions )
+	{
+		if ( Temp.Value >= Index )
+			Temp.Value += Count;
+	}
+}
+
+void FJsonLibraryIndex::Prepare( const TArray<TSharedPtr<FJsonValue>>& Items )
+{
+	if ( !IsCurrent() || Source != &Items || Hashes.Num() != Items.Num() )
+		Build( Items );
+}
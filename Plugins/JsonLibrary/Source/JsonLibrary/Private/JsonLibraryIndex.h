@@ -0,0 +1,49 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+
+// Hash index over the items of a JSON array, keyed by contents.
+// Edits made through any JSON library handle move a shared generation on, so an index that missed one rebuilds on its next lookup.
+struct FJsonLibraryIndex
+{
+	FJsonLibraryIndex();
+
+	// Hash the contents of a JSON value; deep equal values always hash the same.
+	static uint32 Hash( const TSharedPtr<FJsonValue>& Value );
+
+	// Record an edit about to be made to a JSON value, keeping the index of the handle making it current.
+	static void Touch( FJsonLibraryIndex* Index = nullptr );
+
+	// Rebuild the index from all items.
+	void Build( const TArray<TSharedPtr<FJsonValue>>& Items );
+
+	// Update the index after items were inserted.
+	void Insert( const TArray<TSharedPtr<FJsonValue>>& Items, int32 Index, int32 Count = 1 );
+	// Update the index after an item was replaced.
+	void Set( const TArray<TSharedPtr<FJsonValue>>& Items, int32 Index );
+	// Update the index after an item was removed.
+	void Remove( int32 Index );
+
+	// Find the first item at or after an index with the same contents as a value.
+	int32 Find( const TArray<TSharedPtr<FJsonValue>>& Items, const TSharedPtr<FJsonValue>& Value, int32 Index = 0 );
+	// Find all items with the same contents as a value, in ascending order.
+	void FindAll( const TArray<TSharedPtr<FJsonValue>>& Items, const TSharedPtr<FJsonValue>& Value, TArray<int32>& Indices );
+
+private:
+
+	static FThreadSafeCounter64 Edits;
+
+	// Edit generation the index was last current at, and the array it was built from.
+	int64 Generation;
+	const TArray<TSharedPtr<FJsonValue>>* Source;
+
+	TArray<uint32> Hashes;
+	TMultiMap<uint32, int32> Positions;
+
+	bool IsCurrent() const;
+	void Shift( int32 Index, int32 Count );
+	void Prepare( const TArray<TSharedPtr<FJsonValue>>& Items );
+};
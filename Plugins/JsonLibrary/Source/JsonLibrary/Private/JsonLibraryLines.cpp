@@ -0,0 +1,343 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibraryLines.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/Paths.h"
+
+namespace JsonLibraryLines
+{
+	// Buffered bytes that trigger a write on the worker thread.
+	const int32 FlushSize = 1024 * 1024;
+	// Bytes read from the file at a time.
+	const int32 BlockSize = 64 * 1024;
+
+	bool IsBlank( const FString& Text )
+	{
+		for ( const TCHAR Char : Text )
+		{
+			if ( !FChar::IsWhitespace( Char ) )
+				return false;
+		}
+
+		return true;
+	}
+}
+
+struct FJsonLibraryLinesFile
+{
+	TUniquePtr<IFileHandle> Handle;
+	FThreadSafeBool bFailed;
+};
+
+struct FJsonLibraryLinesStream
+{
+	TUniquePtr<IFileHandle> Handle;
+	int64 Position = 0;
+	int64 End = 0;
+
+	TArray<uint8> Block;
+	int32 BlockPosition = 0;
+	TArray<uint8> Line;
+
+	bool Open( const FString& Filename, int64 Offset, int64 Size )
+	{
+		Handle.Reset( FPlatformFileManager::Get().GetPlatformFile().OpenRead( *Filename ) );
+		if ( !Handle.IsValid() )
+			return false;
+
+		const int64 FileSize = Handle->Size();
+		Position = FMath::Clamp<int64>( Offset, 0, FileSize );
+		End = Size < 0 ? FileSize : FMath::Min( Position + Size, FileSize );
+
+		if ( !Handle->Seek( Position ) )
+		{
+			Handle.Reset();
+			return false;
+		}
+
+		// skip a byte order mark at the start of the file
+		if ( Position == 0 && End >= 3 )
+		{
+			uint8 Mark[ 3 ];
+			if ( Handle->Read( Mark, 3 ) && Mark[ 0 ] == 0xEF && Mark[ 1 ] == 0xBB && Mark[ 2 ] == 0xBF )
+				Position = 3;
+
+			Handle->Seek( Position );
+		}
+
+		return true;
+	}
+
+	bool ReadLine( FString& Text )
+	{
+		Line.Reset();
+		while ( true )
+		{
+			if ( BlockPosition >= Block.Num() )
+			{
+				if ( !Handle.IsValid() || Position >= End )
+					break;
+
+				const int32 Count = (int32)FMath::Min<int64>( JsonLibraryLines::BlockSize, End - Position );
+				Block.SetNumUninitialized( Count, false );
+				BlockPosition = 0;
+
+				if ( !Handle->Read( Block.GetData(), Count ) )
+				{
+					Block.Reset();
+					Handle.Reset();
+					break;
+				}
+
+				Position += Count;
+			}
+
+			const int32 Start = BlockPosition;
+			while ( BlockPosition < Block.Num() && Block[ BlockPosition ] != '\n' )
+				BlockPosition++;
+
+			Line.Append( Block.GetData() + Start, BlockPosition - Start );
+			if ( BlockPosition < Block.Num() )
+			{
+				BlockPosition++;
+				Decode( Text );
+				return true;
+			}
+		}
+
+		if ( Line.Num() == 0 )
+			return false;
+
+		Decode( Text );
+		return true;
+	}
+
+	bool Read( FJsonLibraryValue& Value )
+	{
+		FString Text;
+		while ( ReadLine( Text ) )
+		{
+			if ( JsonLibraryLines::IsBlank( Text ) )
+				continue;
+
+			Value = FJsonLibraryValue::Parse( Text );
+			return true;
+		}
+
+		return false;
+	}
+
+private:
+
+	void Decode( FString& Text ) const
+	{
+		int32 Length = Line.Num();
+		if ( Length > 0 && Line[ Length - 1 ] == '\r' )
+			Length--;
+
+		FUTF8ToTCHAR Chars( (const ANSICHAR*)Line.GetData(), Length );
+		Text = FString( Chars.Length(), Chars.Get() );
+	}
+};
+
+UJsonLibraryLinesWriter* UJsonLibraryLinesWriter::OpenWriter( const FString& Filename, bool bAppend /*= true*/ )
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree( *FPaths::GetPath( Filename ) );
+
+	IFileHandle* Handle = PlatformFile.OpenWrite( *Filename, bAppend );
+	if ( !Handle )
+		return nullptr;
+
+	UJsonLibraryLinesWriter* Writer = NewObject<UJsonLibraryLinesWriter>();
+	Writer->File = MakeShareable( new FJsonLibraryLinesFile() );
+	Writer->File->Handle.Reset( Handle );
+	Writer->Buffer.Reserve( JsonLibraryLines::FlushSize );
+
+	return Writer;
+}
+
+bool UJsonLibraryLinesWriter::IsOpen() const
+{
+	return File.IsValid() && !File->bFailed;
+}
+
+bool UJsonLibraryLinesWriter::Write( const FJsonLibraryValue& Value )
+{
+	if ( !IsOpen() )
+		return false;
+
+	const FString Text = Value.Stringify();
+	if ( Text.IsEmpty() )
+		return false;
+
+	FTCHARToUTF8 Line( *Text, Text.Len() );
+	Buffer.Append( (const uint8*)Line.Get(), Line.Length() );
+	Buffer.Add( '\n' );
+
+	if ( Buffer.Num() >= JsonLibraryLines::FlushSize )
+		Flush();
+
+	return true;
+}
+
+void UJsonLibraryLinesWriter::Flush()
+{
+	if ( !File.IsValid() || Buffer.Num() == 0 )
+		return;
+
+	// one write in flight keeps the lines in order and caps memory at two buffers
+	if ( Pending.IsValid() )
+		Pending.Wait();
+
+	TSharedPtr<FJsonLibraryLinesFile, ESPMode::ThreadSafe> Target = File;
+	Pending = Async( EAsyncExecution::ThreadPool, [ Target, Data = MoveTemp( Buffer ) ]()
+	{
+		if ( !Target->bFailed && !Target->Handle->Write( Data.GetData(), Data.Num() ) )
+			Target->bFailed = true;
+	} );
+
+	Buffer.Reset( JsonLibraryLines::FlushSize );
+}
+
+void UJsonLibraryLinesWriter::Close()
+{
+	if ( !File.IsValid() )
+		return;
+
+	Flush();
+	if ( Pending.IsValid() )
+		Pending.Wait();
+
+	File->Handle->Flush();
+	File.Reset();
+	Buffer.Empty();
+}
+
+void UJsonLibraryLinesWriter::BeginDestroy()
+{
+	Close();
+	Super::BeginDestroy();
+}
+
+UJsonLibraryLinesReader* UJsonLibraryLinesReader::OpenReader( const FString& Filename, int64 Offset /*= 0*/, int64 Size /*= -1*/ )
+{
+	TSharedPtr<FJsonLibraryLinesStream> Stream = MakeShareable( new FJsonLibraryLinesStream() );
+	if ( !Stream->Open( Filename, Offset, Size ) )
+		return nullptr;
+
+	UJsonLibraryLinesReader* Reader = NewObject<UJsonLibraryLinesReader>();
+	Reader->Stream = Stream;
+
+	return Reader;
+}
+
+TArray<int64> UJsonLibraryLinesReader::SplitFile( const FString& Filename, int32 Count )
+{
+	TArray<int64> Offsets;
+
+	TUniquePtr<IFileHandle> Handle( FPlatformFileManager::Get().GetPlatformFile().OpenRead( *Filename ) );
+	if ( !Handle.IsValid() )
+		return Offsets;
+
+	const int64 Size = Handle->Size();
+	Count = FMath::Max( Count, 1 );
+
+	// move each even split forward to the start of the next line
+	uint8 Scan[ 4096 ];
+	Offsets.Add( 0 );
+	for ( int32 i = 1; i < Count; i++ )
+	{
+		int64 Position = FMath::Max( Size * i / Count, Offsets.Last() + 1 ) - 1;
+		if ( Position >= Size || !Handle->Seek( Position ) )
+			break;
+
+		int64 Boundary = -1;
+		while ( Boundary < 0 && Position < Size )
+		{
+			const int32 Read = (int32)FMath::Min<int64>( sizeof( Scan ), Size - Position );
+			if ( !Handle->Read( Scan, Read ) )
+				break;
+
+			for ( int32 j = 0; j < Read; j++ )
+			{
+				if ( Scan[ j ] == '\n' )
+				{
+					Boundary = Position + j + 1;
+					break;
+				}
+			}
+
+			Position += Read;
+		}
+
+		if ( Boundary < 0 || Boundary >= Size )
+			break;
+
+		Offsets.Add( Boundary );
+	}
+
+	Offsets.Add( Size );
+	return Offsets;
+}
+
+TArray<FJsonLibraryValue> UJsonLibraryLinesReader::ParseFile( const FString& Filename )
+{
+	TArray<FJsonLibraryValue> Values;
+
+	const TArray<int64> Offsets = SplitFile( Filename, FPlatformMisc::NumberOfCoresIncludingHyperthreads() );
+	if ( Offsets.Num() < 2 )
+		return Values;
+
+	// each chunk is read and parsed by one worker, then the chunks are joined in order
+	TArray<TArray<FJsonLibraryValue>> Chunks;
+	Chunks.SetNum( Offsets.Num() - 1 );
+
+	ParallelFor( Chunks.Num(), [ &Filename, &Offsets, &Chunks ]( int32 Index )
+	{
+		FJsonLibraryLinesStream Stream;
+		if ( !Stream.Open( Filename, Offsets[ Index ], Offsets[ Index + 1 ] - Offsets[ Index ] ) )
+			return;
+
+		FJsonLibraryValue Value;
+		while ( Stream.Read( Value ) )
+			Chunks[ Index ].Add( MoveTemp( Value ) );
+	} );
+
+	int32 Count = 0;
+	for ( const TArray<FJsonLibraryValue>& Chunk : Chunks )
+		Count += Chunk.Num();
+
+	Values.Reserve( Count );
+	for ( TArray<FJsonLibraryValue>& Chunk : Chunks )
+		Values.Append( MoveTemp( Chunk ) );
+
+	return Values;
+}
+
+bool UJsonLibraryLinesReader::IsOpen() const
+{
+	return Stream.IsValid() && Stream->Handle.IsValid();
+}
+
+bool UJsonLibraryLinesReader::Read( FJsonLibraryValue& Value )
+{
+	if ( !Stream.IsValid() )
+		return false;
+
+	return Stream->Read( Value );
+}
+
+bool UJsonLibraryLinesReader::ReadLine( FString& Line )
+{
+	if ( !Stream.IsValid() )
+		return false;
+
+	return Stream->ReadLine( Line );
+}
+
+void UJsonLibraryLinesReader::Close()
+{
+	Stream.Reset();
+}
@@ -2,8 +2,135 @@
 #include "JsonLibraryList.h"
 #include "JsonLibraryObject.h"
 #include "JsonLibraryHelpers.h"
+#include "JsonLibraryNumberCodec.h"
+#include "JsonLibraryCbor.h"
+#include "JsonLibraryIndex.h"
 #include "Policies/CondensedJsonPrintPolicy.h"
 #include "Policies/PrettyJsonPrintPolicy.h"
+#include "Async/ParallelFor.h"
+
+namespace JsonLibraryList
+{
+	// Arrays shorter than this are parsed on the calling thread.
+	const int32 ParallelMinLength = 1024 * 1024;
+	// Smallest chunk of an array handed to one worker.
+	const int32 ParallelChunkLength = 256 * 1024;
+
+	bool IsBlank( const TCHAR* Start, const TCHAR* End )
+	{
+		for ( ; Start < End; Start++ )
+		{
+			if ( !FChar::IsWhitespace( *Start ) )
+				return false;
+		}
+
+		return true;
+	}
+
+	bool Deserialize( const TCHAR* Start, const TCHAR* End, TArray<TSharedPtr<FJsonValue>>& Array )
+	{
+		FString Text;
+		Text.Reserve( (int32)( End - Start ) + 2 );
+		Text.AppendChar( TCHAR( '[' ) );
+		Text.AppendChars( Start, (int32)( End - Start ) );
+		Text.AppendChar( TCHAR( ']' ) );
+
+		TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create( MoveTemp( Text ) );
+		return FJsonSerializer::Deserialize( Reader, Array );
+	}
+
+	// Split a large array at top level commas and parse the chunks across worker threads.
+	bool DeserializeArray( const FString& Text, TArray<TSharedPtr<FJsonValue>>& Array )
+	{
+		const int32 Length = Text.Len();
+		const int32 Workers = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+		const int32 Count = FMath::Min( Length / ParallelChunkLength, Workers * 4 );
+		if ( Length < ParallelMinLength || Count < 2 )
+		{
+			TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create( Text );
+			return FJsonSerializer::Deserialize( Reader, Array );
+		}
+
+		const TCHAR* Start = *Text + 1;
+		const TCHAR* End = *Text + Length - 1;
+		const int32 Target = (int32)( End - Start ) / Count;
+
+		// only strings and nesting are tracked; the parser checks everything else
+		TArray<const TCHAR*> Cuts;
+		Cuts.Add( Start );
+
+		int32 Depth = 0;
+		bool bString = false;
+		for ( const TCHAR* Char = Start; Char < End; Char++ )
+		{
+			if ( bString )
+			{
+				if ( *Char == TCHAR( '\\' ) )
+					Char++;
+				else if ( *Char == TCHAR( '"' ) )
+					bString = false;
+
+				continue;
+			}
+
+			switch ( *Char )
+			{
+				case TCHAR( '"' ): bString = true; break;
+				case TCHAR( '[' ):
+				case TCHAR( '{' ): Depth++; break;
+				case TCHAR( ']' ):
+				case TCHAR( '}' ): Depth--; break;
+				case TCHAR( ',' ):
+					if ( Depth == 0 && Char - Cuts.Last() >= Target )
+						Cuts.Add( Char + 1 );
+					break;
+			}
+
+			if ( Depth < 0 )
+				break;
+		}
+
+		// leave malformed text to the serial parser so it fails the same way
+		if ( bString || Depth != 0 || Cuts.Num() < 2 )
+		{
+			TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create( Text );
+			return FJsonSerializer::Deserialize( Reader, Array );
+		}
+
+		Cuts.Add( End + 1 );
+
+		// an empty chunk means an empty element, which is an error
+		TArray<TArray<TSharedPtr<FJsonValue>>> Chunks;
+		Chunks.SetNum( Cuts.Num() - 1 );
+		for ( int32 i = 0; i < Chunks.Num(); i++ )
+		{
+			if ( IsBlank( Cuts[ i ], Cuts[ i + 1 ] - 1 ) )
+				return false;
+		}
+
+		TAtomic<bool> bFailed( false );
+		ParallelFor( Chunks.Num(), [ &Cuts, &Chunks, &bFailed ]( int32 Index )
+		{
+			if ( bFailed )
+				return;
+			if ( !Deserialize( Cuts[ Index ], Cuts[ Index + 1 ] - 1, Chunks[ Index ] ) )
+				bFailed = true;
+		} );
+
+		if ( bFailed )
+			return false;
+
+		int32 Total = 0;
+		for ( const TArray<TSharedPtr<FJsonValue>>& Chunk : Chunks )
+			Total += Chunk.Num();
+
+		Array.Reset( Total );
+		for ( TArray<TSharedPtr<FJsonValue>>& Chunk : Chunks )
+			Array.Append( MoveTemp( Chunk ) );
+
+		return true;
+	}
+}
 
 FJsonLibraryList::FJsonLibraryList( const TSharedPtr<FJsonValue>& Value )
 {
@@ -55,8 +182,9 @@ FJsonLibraryList::FJsonLibraryList( const TArray<float>& Value )
 	TArray<TSharedPtr<FJsonValue>>* Json = SetJsonArray();
 	if ( Json )
 	{
+		Json->Reserve( Value.Num() );
 		for ( int32 i = 0; i < Value.Num(); i++ )
-			Json->Add( FJsonLibraryValue( Value[ i ] ).JsonValue );
+			Json->Add( MakeShareable( new FJsonValueNumber( Value[ i ] ) ) );
 	}
 }
 
@@ -66,8 +194,9 @@ FJsonLibraryList::FJsonLibraryList( const TArray<double>& Value )
 	TArray<TSharedPtr<FJsonValue>>* Json = SetJsonArray();
 	if ( Json )
 	{
+		Json->Reserve( Value.Num() );
 		for ( int32 i = 0; i < Value.Num(); i++ )
-			Json->Add( FJsonLibraryValue( Value[ i ] ).JsonValue );
+			Json->Add( MakeShareable( new FJsonValueNumber( Value[ i ] ) ) );
 	}
 }
 
@@ -214,6 +343,7 @@ void FJsonLibraryList::Clear()
 
 	NotifyCheck();
 	Json->Empty();
+	IndexReset();
 	NotifyClear();
 }
 
@@ -232,14 +362,20 @@ void FJsonLibraryList::Swap( int32 IndexA, int32 IndexB )
 
 			NotifyCheck( IndexA );
 			( *Json )[ IndexA ] = ValueB;
+			IndexSet( IndexA );
 			NotifyChange( IndexA, FJsonLibraryValue( ValueB ) );
 
 			NotifyCheck( IndexB );
 			( *Json )[ IndexB ] = ValueA;
+			IndexSet( IndexB );
 			NotifyChange( IndexB, FJsonLibraryValue( ValueA ) );
 		}
 		else
+		{
 			Json->Swap( IndexA, IndexB );
+			IndexSet( IndexA );
+			IndexSet( IndexB );
+		}
 	}
 }
 
@@ -259,7 +395,11 @@ void FJsonLibraryList::Append( const FJsonLibraryList& List )
 			AddValue( FJsonLibraryValue( ( *ListJson )[ i ] ) );
 	}
 	else
+	{
+		int32 Index = Json->Num();
 		Json->Append( *ListJson );
+		IndexInsert( Index, ListJson->Num() );
+	}
 }
 
 void FJsonLibraryList::AppendBooleanArray( const TArray<bool>& Array )
@@ -270,8 +410,24 @@ void FJsonLibraryList::AppendBooleanArray( const TArray<bool>& Array )
 
 void FJsonLibraryList::AppendFloatArray( const TArray<float>& Array )
 {
+	if ( OnNotify.IsBound() )
+	{
+		for ( int32 i = 0; i < Array.Num(); i++ )
+			AddValue( FJsonLibraryValue( Array[ i ] ) );
+
+		return;
+	}
+
+	TArray<TSharedPtr<FJsonValue>>* Json = SetJsonArray();
+	if ( !Json )
+		return;
+
+	int32 Index = Json->Num();
+	Json->Reserve( Json->Num() + Array.Num() );
 	for ( int32 i = 0; i < Array.Num(); i++ )
-		AddValue( FJsonLibraryValue( Array[ i ] ) );
+		Json->Add( MakeShareable( new FJsonValueNumber( Array[ i ] ) ) );
+
+	IndexInsert( Index, Array.Num() );
 }
 
 void FJsonLibraryList::AppendIntegerArray( const TArray<int32>& Array )
@@ -282,8 +438,24 @@ void FJsonLibraryList::AppendIntegerArray( const TArray<int32>& Array )
 
 void FJsonLibraryList::AppendNumberArray( const TArray<double>& Array )
 {
+	if ( OnNotify.IsBound() )
+	{
+		for ( int32 i = 0; i < Array.Num(); i++ )
+			AddValue( FJsonLibraryValue( Array[ i ] ) );
+
+		return;
+	}
+
+	TArray<TSharedPtr<FJsonValue>>* Json = SetJsonArray();
+	if ( !Json )
+		return;
+
+	int32 Index = Json->Num();
+	Json->Reserve( Json->Num() + Array.Num() );
 	for ( int32 i = 0; i < Array.Num(); i++ )
-		AddValue( FJsonLibraryValue( Array[ i ] ) );
+		Json->Add( MakeShareable( new FJsonValueNumber( Array[ i ] ) ) );
+
+	IndexInsert( Index, Array.Num() );
 }
 
 void FJsonLibraryList::AppendStringArray( const TArray<FString>& Array )
@@ -356,7 +528,10 @@ void FJsonLibraryList::Inject( int32 Index, const FJsonLibraryList& List )
 			InsertValue( Index + i, FJsonLibraryValue( ( *ListJson )[ i ] ) );
 	}
 	else
+	{
 		Json->Insert( *ListJson, Index );
+		IndexInsert( Index, ListJson->Num() );
+	}
 }
 
 void FJsonLibraryList::InjectBooleanArray( int32 Index, const TArray<bool>& Array )
@@ -505,6 +680,7 @@ void FJsonLibraryList::AddValue( const FJsonLibraryValue& Value )
 
 	int32 Index = Json->Num();
 	Json->Add( Value.JsonValue );
+	IndexInsert( Index );
 	NotifyAdd( Index, Value );
 }
 
@@ -595,6 +771,7 @@ void FJsonLibraryList::InsertValue( int32 Index, const FJsonLibraryValue& Value
 		return;
 
 	Json->Insert( Value.JsonValue, Index );
+	IndexInsert( Index );
 	NotifyAdd( Index, Value );
 }
 
@@ -775,6 +952,7 @@ void FJsonLibraryList::SetValue( int32 Index, const FJsonLibraryValue& Value )
 
 	NotifyCheck( Index );
 	( *Json )[ Index ] = Value.JsonValue;
+	IndexSet( Index );
 	NotifyChange( Index, Value );
 }
 
@@ -806,11 +984,15 @@ void FJsonLibraryList::Remove( int32 Index )
 
 	NotifyCheck( Index );
 	Json->RemoveAt( Index );
+	IndexRemove( Index );
 	NotifyRemove( Index );
 }
 
 void FJsonLibraryList::RemoveBoolean( bool Value )
 {
+	if ( IndexRemoveAll( FJsonLibraryValue( Value ).JsonValue ) )
+		return;
+
 	TArray<TSharedPtr<FJsonValue>>* Json = SetJsonArray();
 	if ( !Json )
 		return;
@@ -822,6 +1004,7 @@ void FJsonLibraryList::RemoveBoolean( bool Value )
 		{
 			NotifyCheck( i );
 			Json->RemoveAt( i );
+			IndexRemove( i );
 			NotifyRemove( i );
 		}
 	}
@@ -839,6 +1022,9 @@ void FJsonLibraryList::RemoveInteger( int32 Value )
 
 void FJsonLibraryList::RemoveNumber( double Value )
 {
+	if ( IndexRemoveAll( FJsonLibraryValue( Value ).JsonValue ) )
+		return;
+
 	TArray<TSharedPtr<FJsonValue>>* Json = SetJsonArray();
 	if ( !Json )
 		return;
@@ -850,6 +1036,7 @@ void FJsonLibraryList::RemoveNumber( double Value )
 		{
 			NotifyCheck( i );
 			Json->RemoveAt( i );
+			IndexRemove( i );
 			NotifyRemove( i );
 		}
 	}
@@ -857,6 +1044,9 @@ void FJsonLibraryList::RemoveNumber( double Value )
 
 void FJsonLibraryList::RemoveString( const FString& Value )
 {
+	if ( IndexRemoveAll( FJsonLibraryValue( Value ).JsonValue ) )
+		return;
+
 	TArray<TSharedPtr<FJsonValue>>* Json = SetJsonArray();
 	if ( !Json )
 		return;
@@ -868,6 +1058,7 @@ void FJsonLibraryList::RemoveString( const FString& Value )
 		{
 			NotifyCheck( i );
 			Json->RemoveAt( i );
+			IndexRemove( i );
 			NotifyRemove( i );
 		}
 	}
@@ -893,6 +1084,7 @@ void FJsonLibraryList::RemoveDateTime( const FDateTime& Value )
 		{
 			NotifyCheck( i );
 			Json->RemoveAt( i );
+			IndexRemove( i );
 			NotifyRemove( i );
 		}
 	}
@@ -918,6 +1110,7 @@ void FJsonLibraryList::RemoveGuid( const FGuid& Value )
 		{
 			NotifyCheck( i );
 			Json->RemoveAt( i );
+			IndexRemove( i );
 			NotifyRemove( i );
 		}
 	}
@@ -936,6 +1129,7 @@ void FJsonLibraryList::RemoveColor( const FColor& Value )
 		{
 			NotifyCheck( i );
 			Json->RemoveAt( i );
+			IndexRemove( i );
 			NotifyRemove( i );
 		}
 	}
@@ -954,6 +1148,7 @@ void FJsonLibraryList::RemoveLinearColor( const FLinearColor& Value )
 		{
 			NotifyCheck( i );
 			Json->RemoveAt( i );
+			IndexRemove( i );
 			NotifyRemove( i );
 		}
 	}
@@ -972,6 +1167,7 @@ void FJsonLibraryList::RemoveRotator( const FRotator& Value )
 		{
 			NotifyCheck( i );
 			Json->RemoveAt( i );
+			IndexRemove( i );
 			NotifyRemove( i );
 		}
 	}
@@ -990,6 +1186,7 @@ void FJsonLibraryList::RemoveTransform( const FTransform& Value )
 		{
 			NotifyCheck( i );
 			Json->RemoveAt( i );
+			IndexRemove( i );
 			NotifyRemove( i );
 		}
 	}
@@ -1008,6 +1205,7 @@ void FJsonLibraryList::RemoveVector( const FVector& Value )
 		{
 			NotifyCheck( i );
 			Json->RemoveAt( i );
+			IndexRemove( i );
 			NotifyRemove( i );
 		}
 	}
@@ -1015,6 +1213,9 @@ void FJsonLibraryList::RemoveVector( const FVector& Value )
 
 void FJsonLibraryList::RemoveValue( const FJsonLibraryValue& Value )
 {
+	if ( IndexRemoveAll( Value.JsonValue ) )
+		return;
+
 	TArray<TSharedPtr<FJsonValue>>* Json = SetJsonArray();
 	if ( !Json )
 		return;
@@ -1025,6 +1226,7 @@ void FJsonLibraryList::RemoveValue( const FJsonLibraryValue& Value )
 		{
 			NotifyCheck( i );
 			Json->RemoveAt( i );
+			IndexRemove( i );
 			NotifyRemove( i );
 		}
 	}
@@ -1046,6 +1248,9 @@ int32 FJsonLibraryList::FindBoolean( bool Value, int32 Index ) const
 	if ( !Json )
 		return -1;
 
+	if ( JsonIndex.IsValid() )
+		return IndexFind( FJsonLibraryValue( Value ).JsonValue, Index );
+
 	for ( int32 i = Index; i < Json->Num(); i++ )
 	{
 		const TSharedPtr<FJsonValue>& Item = ( *Json )[ i ];
@@ -1072,6 +1277,9 @@ int32 FJsonLibraryList::FindNumber( double Value, int32 Index ) const
 	if ( !Json )
 		return -1;
 
+	if ( JsonIndex.IsValid() )
+		return IndexFind( FJsonLibraryValue( Value ).JsonValue, Index );
+
 	for ( int32 i = Index; i < Json->Num(); i++ )
 	{
 		const TSharedPtr<FJsonValue>& Item = ( *Json )[ i ];
@@ -1088,6 +1296,9 @@ int32 FJsonLibraryList::FindString( const FString& Value, int32 Index ) const
 	if ( !Json )
 		return -1;
 
+	if ( JsonIndex.IsValid() )
+		return IndexFind( FJsonLibraryValue( Value ).JsonValue, Index );
+
 	for ( int32 i = Index; i < Json->Num(); i++ )
 	{
 		const TSharedPtr<FJsonValue>& Item = ( *Json )[ i ];
@@ -1230,6 +1441,9 @@ int32 FJsonLibraryList::FindValue( const FJsonLibraryValue& Value, int32 Index )
 	if ( !Json )
 		return -1;
 
+	if ( JsonIndex.IsValid() )
+		return IndexFind( Value.JsonValue, Index );
+
 	for ( int32 i = Index; i < Json->Num(); i++ )
 		if ( Value.Equals( FJsonLibraryValue( ( *Json )[ i ] ) ) )
 			return i;
@@ -1247,6 +1461,29 @@ int32 FJsonLibraryList::FindList( const FJsonLibraryList& Value, int32 Index ) c
 	return FindValue( FJsonLibraryValue( Value ), Index );
 }
 
+void FJsonLibraryList::SetIndexed( bool bIndexed )
+{
+	if ( !bIndexed )
+	{
+		JsonIndex.Reset();
+		return;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
+	if ( !Json )
+		return;
+
+	if ( !JsonIndex.IsValid() )
+		JsonIndex = MakeShareable( new FJsonLibraryIndex() );
+
+	JsonIndex->Build( *Json );
+}
+
+bool FJsonLibraryList::IsIndexed() const
+{
+	return JsonIndex.IsValid();
+}
+
 const TArray<TSharedPtr<FJsonValue>>* FJsonLibraryList::GetJsonArray() const
 {
 	if ( JsonArray.IsValid() && JsonArray->Type == EJson::Array )
@@ -1261,6 +1498,10 @@ const TArray<TSharedPtr<FJsonValue>>* FJsonLibraryList::GetJsonArray() const
 
 TArray<TSharedPtr<FJsonValue>>* FJsonLibraryList::SetJsonArray()
 {
+	// an array only this handle holds cannot be seen through any other handle
+	if ( JsonArray.IsValid() && !JsonArray.IsUnique() )
+		FJsonLibraryIndex::Touch( JsonIndex.Get() );
+
 	return const_cast<TArray<TSharedPtr<FJsonValue>>*>( GetJsonArray() );
 }
 
@@ -1280,8 +1521,7 @@ bool FJsonLibraryList::TryParse( const FString& Text, bool bStripComments /*= fa
 		return false;
 
 	TArray<TSharedPtr<FJsonValue>> Array;
-	TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create( TrimmedText );
-	if ( !FJsonSerializer::Deserialize( Reader, Array ) )
+	if ( !JsonLibraryList::DeserializeArray( TrimmedText, Array ) )
 		return false;
 
 	JsonArray = MakeShareable( new FJsonValueArray( Array ) );
@@ -1430,6 +1670,76 @@ void FJsonLibraryList::NotifyRemove( int32 Index )
 	NotifyValue.Reset();
 }
 
+void FJsonLibraryList::IndexInsert( int32 Index, int32 Count /*= 1*/ )
+{
+	if ( !JsonIndex.IsValid() || Count <= 0 )
+		return;
+
+	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
+	if ( Json )
+		JsonIndex->Insert( *Json, Index, Count );
+}
+
+void FJsonLibraryList::IndexSet( int32 Index )
+{
+	if ( !JsonIndex.IsValid() )
+		return;
+
+	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
+	if ( Json )
+		JsonIndex->Set( *Json, Index );
+}
+
+void FJsonLibraryList::IndexRemove( int32 Index )
+{
+	if ( JsonIndex.IsValid() )
+		JsonIndex->Remove( Index );
+}
+
+void FJsonLibraryList::IndexReset()
+{
+	if ( !JsonIndex.IsValid() )
+		return;
+
+	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
+	if ( Json )
+		JsonIndex->Build( *Json );
+}
+
+int32 FJsonLibraryList::IndexFind( const TSharedPtr<FJsonValue>& Value, int32 Index ) const
+{
+	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
+	if ( !Json || !JsonIndex.IsValid() )
+		return -1;
+
+	return JsonIndex->Find( *Json, Value, FMath::Max( Index, 0 ) );
+}
+
+bool FJsonLibraryList::IndexRemoveAll( const TSharedPtr<FJsonValue>& Value )
+{
+	if ( !JsonIndex.IsValid() )
+		return false;
+
+	TArray<TSharedPtr<FJsonValue>>* Json = SetJsonArray();
+	if ( !Json )
+		return true;
+
+	TArray<int32> Indices;
+	JsonIndex->FindAll( *Json, Value, Indices );
+
+	for ( int32 i = Indices.Num() - 1; i >= 0; i-- )
+	{
+		const int32 Index = Indices[ i ];
+
+		NotifyCheck( Index );
+		Json->RemoveAt( Index );
+		IndexRemove( Index );
+		NotifyRemove( Index );
+	}
+
+	return true;
+}
+
 bool FJsonLibraryList::IsValid() const
 {
 	if ( GetJsonArray() )
@@ -1482,6 +1792,125 @@ FString FJsonLibraryList::Stringify( bool bCondensed /*= true*/ ) const
 	return FString();
 }
 
+bool FJsonLibraryList::ParseFloatArray( const FString& Text, TArray<float>& Array )
+{
+	if ( FJsonLibraryNumberCodec::ReadFloatArray( *Text, Text.Len(), Array ) )
+		return true;
+
+	Array.Reset();
+	return false;
+}
+
+bool FJsonLibraryList::ParseNumberArray( const FString& Text, TArray<double>& Array )
+{
+	if ( FJsonLibraryNumberCodec::ReadDoubleArray( *Text, Text.Len(), Array ) )
+		return true;
+
+	Array.Reset();
+	return false;
+}
+
+FString FJsonLibraryList::StringifyFloatArray( const TArray<float>& Array )
+{
+	FString Text;
+	FJsonLibraryNumberCodec::WriteFloatArray( Array.GetData(), Array.Num(), Text );
+
+	return Text;
+}
+
+FString FJsonLibraryList::StringifyNumberArray( const TArray<double>& Array )
+{
+	FString Text;
+	FJsonLibraryNumberCodec::WriteDoubleArray( Array.GetData(), Array.Num(), Text );
+
+	return Text;
+}
+
+bool FJsonLibraryList::TryParseCbor( const TArray<uint8>& Data )
+{
+	if ( Data.Num() <= 0 )
+		return false;
+
+	TSharedPtr<FJsonValue> Value;
+	FJsonLibraryCborReader Reader( Data.GetData(), Data.Num() );
+	if ( !Reader.ReadValue( Value ) || !Reader.IsDone() || Value->Type != EJson::Array )
+		return false;
+
+	JsonArray = StaticCastSharedPtr<FJsonValueArray>( Value );
+
+	NotifyParse();
+	return true;
+}
+
+FJsonLibraryList FJsonLibraryList::ParseCbor( const TArray<uint8>& Data )
+{
+	FJsonLibraryList List = TSharedPtr<FJsonValueArray>();
+	if ( !List.TryParseCbor( Data ) )
+		List.JsonArray.Reset();
+
+	return List;
+}
+
+FJsonLibraryList FJsonLibraryList::ParseCbor( const TArray<uint8>& Data, const FJsonLibraryListNotify& Notify )
+{
+	FJsonLibraryList List = ParseCbor( Data );
+	List.OnNotify = Notify;
+
+	return List;
+}
+
+TArray<uint8> FJsonLibraryList::EncodeCbor( bool bTypedArrays /*= true*/ ) const
+{
+	TArray<uint8> Data;
+	if ( !GetJsonArray() )
+		return Data;
+
+	FJsonLibraryCborWriter Writer( Data, bTypedArrays );
+	Writer.WriteValue( JsonArray );
+
+	return Data;
+}
+
+bool FJsonLibraryList::ParseCborFloatArray( const TArray<uint8>& Data, TArray<float>& Array )
+{
+	EJsonNotation Notation;
+	FJsonLibraryCborReader Reader( Data.GetData(), Data.Num() );
+	if ( Reader.ReadNext( Notation ) && Notation == EJsonNotation::ArrayStart && Reader.ReadFloatArray( Array ) && Reader.IsDone() )
+		return true;
+
+	Array.Reset();
+	return false;
+}
+
+bool FJsonLibraryList::ParseCborNumberArray( const TArray<uint8>& Data, TArray<double>& Array )
+{
+	EJsonNotation Notation;
+	FJsonLibraryCborReader Reader( Data.GetData(), Data.Num() );
+	if ( Reader.ReadNext( Notation ) && Notation == EJsonNotation::ArrayStart && Reader.ReadNumberArray( Array ) && Reader.IsDone() )
+		return true;
+
+	Array.Reset();
+	return false;
+}
+
+TArray<uint8> FJsonLibraryList::EncodeCborFloatArray( const TArray<float>& Array )
+{
+	TArray<uint8> Data;
+	FJsonLibraryCborWriter Writer( Data );
+	Writer.WriteFloatArray( Array.GetData(), Array.Num() );
+
+	return Data;
+}
+
+TArray<uint8> FJsonLibraryList::EncodeCborNumberArray( const TArray<double>& Array )
+{
+	TArray<uint8> Data;
+	FJsonLibraryCborWriter Writer( Data );
+	Writer.WriteNumberArray( Array.GetData(), Array.Num() );
+
+	return Data;
+}
+
 TArray<FJsonLibraryValue> FJsonLibraryList::ToArray() const
 {
 	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
@@ -1496,6 +1925,17 @@ TArray<FJsonLibraryValue> FJsonLibraryList::ToArray() const
 	return Array;
 }
 
+FJsonLibraryList::FConstIterator FJsonLibraryList::begin() const
+{
+	return FConstIterator( GetJsonArray(), 0 );
+}
+
+FJsonLibraryList::FConstIterator FJsonLibraryList::end() const
+{
+	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
+	return FConstIterator( Json, Json ? Json->Num() : 0 );
+}
+
 TArray<bool> FJsonLibraryList::ToBooleanArray() const
 {
 	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
@@ -1518,8 +1958,15 @@ TArray<float> FJsonLibraryList::ToFloatArray() const
 	if ( !Json )
 		return Array;
 
+	Array.SetNumUninitialized( Json->Num() );
 	for ( int32 i = 0; i < Json->Num(); i++ )
-		Array.Add( FJsonLibraryValue( ( *Json )[ i ] ).GetFloat() );
+	{
+		const TSharedPtr<FJsonValue>& Item = ( *Json )[ i ];
+		if ( Item.IsValid() && Item->Type == EJson::Number )
+			Array[ i ] = (float)Item->AsNumber();
+		else
+			Array[ i ] = FJsonLibraryValue( Item ).GetFloat();
+	}
 
 	return Array;
 }
@@ -1546,8 +1993,15 @@ TArray<double> FJsonLibraryList::ToNumberArray() const
 	if ( !Json )
 		return Array;
 
+	Array.SetNumUninitialized( Json->Num() );
 	for ( int32 i = 0; i < Json->Num(); i++ )
-		Array.Add( FJsonLibraryValue( ( *Json )[ i ] ).GetNumber() );
+	{
+		const TSharedPtr<FJsonValue>& Item = ( *Json )[ i ];
+		if ( Item.IsValid() && Item->Type == EJson::Number )
+			Array[ i ] = (double)Item->AsNumber();
+		else
+			Array[ i ] = FJsonLibraryValue( Item ).GetNumber();
+	}
 
 	return Array;
 }
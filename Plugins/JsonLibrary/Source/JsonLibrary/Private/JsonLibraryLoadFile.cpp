@@ -0,0 +1,184 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibraryLoadFile.h"
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/FileHelper.h"
+
+struct FJsonLibraryLoadFileState
+{
+	FThreadSafeBool bCancelled;
+	FThreadSafeBool bFinished;
+};
+
+namespace JsonLibraryLoadFile
+{
+	// Bytes decoded between progress updates and cancellation checks.
+	const int64 ChunkSize = 4 * 1024 * 1024;
+
+	// Decode UTF-8 in chunks so progress can be reported and loading cancelled part way.
+	bool Decode( const uint8* Data, int64 Size, FString& Text, FJsonLibraryLoadFileState& State, TFunctionRef<void( float )> Progress )
+	{
+		if ( Size >= 3 && Data[ 0 ] == 0xEF && Data[ 1 ] == 0xBB && Data[ 2 ] == 0xBF )
+		{
+			Data += 3;
+			Size -= 3;
+		}
+
+		Text.Empty( (int32)FMath::Min<int64>( Size, MAX_int32 ) );
+
+		int64 Start = 0;
+		while ( Start < Size )
+		{
+			if ( State.bCancelled )
+				return false;
+
+			// never split a multi-byte sequence across chunks
+			int64 End = FMath::Min( Start + ChunkSize, Size );
+			while ( End < Size && End > Start && ( Data[ End ] & 0xC0 ) == 0x80 )
+				End--;
+
+			// a chunk of nothing but continuation bytes is malformed, so it is decoded whole rather than never advancing
+			if ( End == Start )
+				End = FMath::Min( Start + ChunkSize, Size );
+
+			FUTF8ToTCHAR Chunk( (const ANSICHAR*)( Data + Start ), (int32)( End - Start ) );
+			Text.AppendChars( Chunk.Get(), Chunk.Length() );
+
+			Start = End;
+			Progress( (float)( (double)Start / (double)Size ) );
+		}
+
+		return true;
+	}
+
+	bool Read( const FString& Filename, FString& Text, FJsonLibraryLoadFileState& State, TFunctionRef<void( float )> Progress )
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		// map the file where the platform allows it, so it is never read into a second buffer
+		TUniquePtr<IMappedFileHandle> Handle( PlatformFile.OpenMapped( *Filename ) );
+		if ( Handle.IsValid() )
+		{
+			TUniquePtr<IMappedFileRegion> Region( Handle->MapRegion() );
+			if ( Region.IsValid() )
+			{
+				const uint8* Data = Region->GetMappedPtr();
+				const int64 Size = Region->GetMappedSize();
+
+				const bool bUtf16 = Size >= 2 && ( ( Data[ 0 ] == 0xFF && Data[ 1 ] == 0xFE ) || ( Data[ 0 ] == 0xFE && Data[ 1 ] == 0xFF ) );
+				if ( !bUtf16 )
+					return Decode( Data, Size, Text, State, Progress );
+			}
+		}
+
+		TArray<uint8> Bytes;
+		if ( !FFileHelper::LoadFileToArray( Bytes, *Filename ) )
+			return false;
+
+		if ( Bytes.Num() >= 2 && ( ( Bytes[ 0 ] == 0xFF && Bytes[ 1 ] == 0xFE ) || ( Bytes[ 0 ] == 0xFE && Bytes[ 1 ] == 0xFF ) ) )
+		{
+			FFileHelper::BufferToString( Text, Bytes.GetData(), Bytes.Num() );
+			Progress( 1.0f );
+			return true;
+		}
+
+		return Decode( Bytes.GetData(), Bytes.Num(), Text, State, Progress );
+	}
+}
+
+UJsonLibraryLoadFile* UJsonLibraryLoadFile::LoadFile( UObject* WorldContextObject, const FString& Filename )
+{
+	UJsonLibraryLoadFile* Action = NewObject<UJsonLibraryLoadFile>();
+	Action->Filename = Filename;
+	Action->RegisterWithGameInstance( WorldContextObject );
+
+	return Action;
+}
+
+void UJsonLibraryLoadFile::Cancel()
+{
+	bCancelled = true;
+	if ( State.IsValid() )
+		State->bCancelled = true;
+
+	SetReadyToDestroy();
+}
+
+bool UJsonLibraryLoadFile::IsLoading() const
+{
+	return State.IsValid() && !State->bCancelled && !State->bFinished;
+}
+
+void UJsonLibraryLoadFile::Activate()
+{
+	if ( State.IsValid() || bCancelled )
+		return;
+
+	State = MakeShareable( new FJsonLibraryLoadFileState() );
+
+	TWeakObjectPtr<UJsonLibraryLoadFile> WeakThis( this );
+	TSharedPtr<FJsonLibraryLoadFileState, ESPMode::ThreadSafe> LoadState = State;
+	FString LoadFilename = Filename;
+
+	Async( EAsyncExecution::ThreadPool, [ WeakThis, LoadState, LoadFilename ]()
+	{
+		// decoding is reported as the first half of the progress, parsing as the second
+		float Reported = 0.0f;
+		auto Progress = [ &Reported, WeakThis ]( float Value )
+		{
+			Value *= 0.5f;
+			if ( Value - Reported < 0.01f && Value < 0.5f )
+				return;
+
+			Reported = Value;
+			AsyncTask( ENamedThreads::GameThread, [ WeakThis, Value ]()
+			{
+				if ( WeakThis.IsValid() )
+					WeakThis->HandleProgress( Value );
+			} );
+		};
+
+		TSharedPtr<FJsonValue> Value;
+
+		FString Text;
+		if ( JsonLibraryLoadFile::Read( LoadFilename, Text, *LoadState, Progress ) && !LoadState->bCancelled )
+		{
+			TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create( MoveTemp( Text ) );
+			if ( !FJsonSerializer::Deserialize( Reader, Value ) )
+				Value.Reset();
+		}
+
+		// the parsed tree is handed over whole, nothing on this thread keeps a reference to it
+		AsyncTask( ENamedThreads::GameThread, [ WeakThis, Value = MoveTemp( Value ) ]()
+		{
+			if ( WeakThis.IsValid() )
+				WeakThis->HandleComplete( Value );
+		} );
+	} );
+}
+
+void UJsonLibraryLoadFile::HandleProgress( float Progress )
+{
+	if ( !IsLoading() )
+		return;
+
+	OnProgress.Broadcast( FJsonLibraryValue(), Progress );
+}
+
+void UJsonLibraryLoadFile::HandleComplete( const TSharedPtr<FJsonValue>& Value )
+{
+	if ( !IsLoading() )
+		return;
+
+	State->bFinished = true;
+	if ( Value.IsValid() )
+	{
+		OnProgress.Broadcast( FJsonLibraryValue(), 1.0f );
+		OnComplete.Broadcast( FJsonLibraryValue( Value ), 1.0f );
+	}
+	else
+		OnFailed.Broadcast( FJsonLibraryValue(), 1.0f );
+
+	SetReadyToDestroy();
+}
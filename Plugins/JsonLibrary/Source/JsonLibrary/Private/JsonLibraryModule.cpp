@@ -1,19 +1,53 @@
 // Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
 #include "JsonLibraryModule.h"
+#include "JsonLibraryConverter.h"
 #include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
 
 class FJsonLibraryModule : public IJsonLibraryModule
 {
 public:
 	virtual void StartupModule() override
 	{
-		//
+#if WITH_HOT_RELOAD
+		ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw( this, &FJsonLibraryModule::HandleReloadComplete );
+#endif
+#if WITH_EDITOR
+		ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddRaw( this, &FJsonLibraryModule::HandleObjectsReplaced );
+#endif
 	}
 
 	virtual void ShutdownModule() override
 	{
-		//
+#if WITH_HOT_RELOAD
+		FCoreUObjectDelegates::ReloadCompleteDelegate.Remove( ReloadCompleteHandle );
+#endif
+#if WITH_EDITOR
+		FCoreUObjectDelegates::OnObjectsReplaced.Remove( ObjectsReplacedHandle );
+#endif
+		FJsonLibraryConverter::ResetCachedPlans();
 	}
+
+private:
+
+#if WITH_HOT_RELOAD
+	FDelegateHandle ReloadCompleteHandle;
+
+	void HandleReloadComplete( EReloadCompleteReason Reason )
+	{
+		FJsonLibraryConverter::ResetCachedPlans();
+	}
+#endif
+
+#if WITH_EDITOR
+	FDelegateHandle ObjectsReplacedHandle;
+
+	// recompiled structs can be relinked in place, so plans built from their old properties are dropped
+	void HandleObjectsReplaced( const TMap<UObject*, UObject*>& ReplacementMap )
+	{
+		FJsonLibraryConverter::ResetCachedPlans();
+	}
+#endif
 };
 
 IMPLEMENT_MODULE(FJsonLibraryModule, JsonLibrary);
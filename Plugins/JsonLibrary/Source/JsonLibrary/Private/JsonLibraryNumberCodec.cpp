@@ -0,0 +1,718 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibraryNumberCodec.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace JsonLibraryNumberCodec
+{
+	// Shortest round-trip formatting follows Ryu (Ulf Adams, PLDI 2018).
+	// These are the single precision tables, 59 and 61 bits wide.
+	static const uint64 FloatPow5InvSplit[ 31 ] =
+	{
+		0x0800000000000001, 0x0666666666666667, 0x051EB851EB851EB9, 0x04189374BC6A7EFA,
+		0x068DB8BAC710CB2A, 0x053E2D6238DA3C22, 0x0431BDE82D7B634E, 0x06B5FCA6AF2BD216,
+		0x055E63B88C230E78, 0x044B82FA09B5A52D, 0x06DF37F675EF6EAE, 0x057F5FF85E592558,
+		0x0465E6604B7A8447, 0x0709709A125DA071, 0x05A126E1A84AE6C1, 0x0480EBE7B9D58567,
+		0x0734ACA5F6226F0B, 0x05C3BD5191B525A3, 0x049C97747490EAE9, 0x0760F253EDB4AB0E,
+		0x05E72843249088D8, 0x04B8ED0283A6D3E0, 0x078E480405D7B966, 0x060B6CD004AC9452,
+		0x04D5F0A66A23A9DB, 0x07BCB43D769F762B, 0x063090312BB2C4EF, 0x04F3A68DBC8F03F3,
+		0x07EC3DAF94180651, 0x065697BFA9ACD1DA, 0x051212FFBAF0A7E2,
+	};
+
+	static const uint64 FloatPow5Split[ 47 ] =
+	{
+		0x1000000000000000, 0x1400000000000000, 0x1900000000000000, 0x1F40000000000000,
+		0x1388000000000000, 0x186A000000000000, 0x1E84800000000000, 0x1312D00000000000,
+		0x17D7840000000000, 0x1DCD650000000000, 0x12A05F2000000000, 0x174876E800000000,
+		0x1D1A94A200000000, 0x12309CE540000000, 0x16BCC41E90000000, 0x1C6BF52634000000,
+		0x11C37937E0800000, 0x16345785D8A00000, 0x1BC16D674EC80000, 0x1158E460913D0000,
+		0x15AF1D78B58C4000, 0x1B1AE4D6E2EF5000, 0x10F0CF064DD59200, 0x152D02C7E14AF680,
+		0x1A784379D99DB420, 0x108B2A2C28029094, 0x14ADF4B7320334B9, 0x19D971E4FE8401E7,
+		0x1027E72F1F128130, 0x1431E0FAE6D7217C, 0x193E5939A08CE9DB, 0x1F8DEF8808B02452,
+		0x13B8B5B5056E16B3, 0x18A6E32246C99C60, 0x1ED09BEAD87C0378, 0x13426172C74D822B,
+		0x1812F9CF7920E2B6, 0x1E17B84357691B64, 0x12CED32A16A1B11E, 0x178287F49C4A1D66,
+		0x1D6329F1C35CA4BF, 0x125DFA371A19E6F7, 0x16F578C4E0A060B5, 0x1CB2D6F618C878E3,
+		0x11EFC659CF7D4B8D, 0x166BB7F0435C9E71, 0x1C06A5EC5433C60D,
+	};
+
+	static const int32 FloatPow5InvBitCount = 59;
+	static const int32 FloatPow5BitCount    = 61;
+
+	// Powers of ten that are exactly representable as doubles.
+	static const double ExactPowersOfTen[ 23 ] =
+	{
+		1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+	};
+
+	FORCEINLINE int32 Pow5Bits( int32 Exponent )
+	{
+		return (int32)( ( (uint32)Exponent * 1217359 ) >> 19 ) + 1;
+	}
+
+	FORCEINLINE uint32 Log10Pow2( int32 Exponent )
+	{
+		return ( (uint32)Exponent * 78913 ) >> 18;
+	}
+
+	FORCEINLINE uint32 Log10Pow5( int32 Exponent )
+	{
+		return ( (uint32)Exponent * 732923 ) >> 20;
+	}
+
+	FORCEINLINE bool MultipleOfPowerOf5( uint32 Value, uint32 Power )
+	{
+		uint32 Count = 0;
+		while ( Value % 5 == 0 )
+		{
+			Value /= 5;
+			Count++;
+		}
+
+		return Count >= Power;
+	}
+
+	FORCEINLINE bool MultipleOfPowerOf2( uint32 Value, uint32 Power )
+	{
+		return ( Value & ( ( 1u << Power ) - 1 ) ) == 0;
+	}
+
+	FORCEINLINE uint32 MulShift( uint32 Value, uint64 Factor, int32 Shift )
+	{
+		const uint64 Low  = (uint64)Value * (uint32)Factor;
+		const uint64 High = (uint64)Value * (uint32)( Factor >> 32 );
+		return (uint32)( ( ( Low >> 32 ) + High ) >> ( Shift - 32 ) );
+	}
+
+	// Convert a finite, non-zero float to the shortest decimal Mantissa * 10^Exponent.
+	static void FloatToDecimal( uint32 IeeeMantissa, uint32 IeeeExponent, uint32& Mantissa, int32& Exponent )
+	{
+		int32 E2;
+		uint32 M2;
+		if ( IeeeExponent == 0 )
+		{
+			E2 = 1 - 127 - 23 - 2;
+			M2 = IeeeMantissa;
+		}
+		else
+		{
+			E2 = (int32)IeeeExponent - 127 - 23 - 2;
+			M2 = ( 1u << 23 ) | IeeeMantissa;
+		}
+
+		const bool bAcceptBounds = ( M2 & 1 ) == 0;
+
+		const uint32 MV = 4 * M2;
+		const uint32 MP = 4 * M2 + 2;
+		const uint32 MMShift = IeeeMantissa != 0 || IeeeExponent <= 1 ? 1 : 0;
+		const uint32 MM = 4 * M2 - 1 - MMShift;
+
+		uint32 VR, VP, VM;
+		int32 E10;
+		bool bVMIsTrailingZeros = false;
+		bool bVRIsTrailingZeros = false;
+		uint32 LastRemovedDigit = 0;
+
+		if ( E2 >= 0 )
+		{
+			const uint32 Q = Log10Pow2( E2 );
+			E10 = (int32)Q;
+
+			const int32 K = FloatPow5InvBitCount + Pow5Bits( (int32)Q ) - 1;
+			const int32 I = -E2 + (int32)Q + K;
+			VR = MulShift( MV, FloatPow5InvSplit[ Q ], I );
+			VP = MulShift( MP, FloatPow5InvSplit[ Q ], I );
+			VM = MulShift( MM, FloatPow5InvSplit[ Q ], I );
+
+			if ( Q != 0 && ( VP - 1 ) / 10 <= VM / 10 )
+			{
+				const int32 L = FloatPow5InvBitCount + Pow5Bits( (int32)( Q - 1 ) ) - 1;
+				LastRemovedDigit = MulShift( MV, FloatPow5InvSplit[ Q - 1 ], -E2 + (int32)Q - 1 + L ) % 10;
+			}
+
+			if ( Q <= 9 )
+			{
+				if ( MV % 5 == 0 )
+					bVRIsTrailingZeros = MultipleOfPowerOf5( MV, Q );
+				else if ( bAcceptBounds )
+					bVMIsTrailingZeros = MultipleOfPowerOf5( MM, Q );
+				else
+					VP -= MultipleOfPowerOf5( MP, Q ) ? 1 : 0;
+			}
+		}
+		else
+		{
+			const uint32 Q = Log10Pow5( -E2 );
+			E10 = (int32)Q + E2;
+
+			const int32 I = -E2 - (int32)Q;
+			const int32 K = Pow5Bits( I ) - FloatPow5BitCount;
+			int32 J = (int32)Q - K;
+			VR = MulShift( MV, FloatPow5Split[ I ], J );
+			VP = MulShift( MP, FloatPow5Split[ I ], J );
+			VM = MulShift( MM, FloatPow5Split[ I ], J );
+
+			if ( Q != 0 && ( VP - 1 ) / 10 <= VM / 10 )
+			{
+				J = (int32)Q - 1 - ( Pow5Bits( I + 1 ) - FloatPow5BitCount );
+				LastRemovedDigit = MulShift( MV, FloatPow5Split[ I + 1 ], J ) % 10;
+			}
+
+			if ( Q <= 1 )
+			{
+				bVRIsTrailingZeros = true;
+				if ( bAcceptBounds )
+					bVMIsTrailingZeros = MMShift == 1;
+				else
+					VP--;
+			}
+			else if ( Q < 31 )
+				bVRIsTrailingZeros = MultipleOfPowerOf2( MV, Q - 1 );
+		}
+
+		int32 Removed = 0;
+		if ( bVMIsTrailingZeros || bVRIsTrailingZeros )
+		{
+			while ( VP / 10 > VM / 10 )
+			{
+				bVMIsTrailingZeros &= VM % 10 == 0;
+				bVRIsTrailingZeros &= LastRemovedDigit == 0;
+				LastRemovedDigit = VR % 10;
+				VR /= 10;
+				VP /= 10;
+				VM /= 10;
+				Removed++;
+			}
+
+			if ( bVMIsTrailingZeros )
+			{
+				while ( VM % 10 == 0 )
+				{
+					bVRIsTrailingZeros &= LastRemovedDigit == 0;
+					LastRemovedDigit = VR % 10;
+					VR /= 10;
+					VP /= 10;
+					VM /= 10;
+					Removed++;
+				}
+			}
+
+			if ( bVRIsTrailingZeros && LastRemovedDigit == 5 && VR % 2 == 0 )
+				LastRemovedDigit = 4;
+
+			Mantissa = VR + ( ( VR == VM && ( !bAcceptBounds || !bVMIsTrailingZeros ) ) || LastRemovedDigit >= 5 ? 1 : 0 );
+		}
+		else
+		{
+			while ( VP / 10 > VM / 10 )
+			{
+				LastRemovedDigit = VR % 10;
+				VR /= 10;
+				VP /= 10;
+				VM /= 10;
+				Removed++;
+			}
+
+			Mantissa = VR + ( VR == VM || LastRemovedDigit >= 5 ? 1 : 0 );
+		}
+
+		Exponent = E10 + Removed;
+	}
+
+	// Lay out decimal digits the way JSON.stringify does.
+	template<typename CharType>
+	static int32 WriteDecimal( bool bNegative, uint32 Mantissa, int32 Exponent, CharType* Buffer )
+	{
+		CharType Digits[ 10 ];
+		int32 Count = 0;
+		do
+		{
+			Digits[ 9 - Count++ ] = (CharType)( '0' + Mantissa % 10 );
+			Mantissa /= 10;
+		}
+		while ( Mantissa != 0 );
+
+		const CharType* First = Digits + 10 - Count;
+		const int32 Point = Count + Exponent;
+
+		CharType* Out = Buffer;
+		if ( bNegative )
+			*Out++ = '-';
+
+		if ( Count <= Point && Point <= 21 )
+		{
+			for ( int32 i = 0; i < Count; i++ )
+				*Out++ = First[ i ];
+			for ( int32 i = Count; i < Point; i++ )
+				*Out++ = '0';
+		}
+		else if ( 0 < Point && Point <= 21 )
+		{
+			for ( int32 i = 0; i < Point; i++ )
+				*Out++ = First[ i ];
+			*Out++ = '.';
+			for ( int32 i = Point; i < Count; i++ )
+				*Out++ = First[ i ];
+		}
+		else if ( -6 < Point && Point <= 0 )
+		{
+			*Out++ = '0';
+			*Out++ = '.';
+			for ( int32 i = Point; i < 0; i++ )
+				*Out++ = '0';
+			for ( int32 i = 0; i < Count; i++ )
+				*Out++ = First[ i ];
+		}
+		else
+		{
+			*Out++ = First[ 0 ];
+			if ( Count > 1 )
+			{
+				*Out++ = '.';
+				for ( int32 i = 1; i < Count; i++ )
+					*Out++ = First[ i ];
+			}
+
+			int32 Power = Point - 1;
+			*Out++ = 'e';
+			if ( Power < 0 )
+			{
+				*Out++ = '-';
+				Power = -Power;
+			}
+
+			if ( Power >= 10 )
+				*Out++ = (CharType)( '0' + Power / 10 );
+			*Out++ = (CharType)( '0' + Power % 10 );
+		}
+
+		return (int32)( Out - Buffer );
+	}
+
+	template<typename CharType>
+	static int32 WriteNull( CharType* Buffer )
+	{
+		Buffer[ 0 ] = 'n';
+		Buffer[ 1 ] = 'u';
+		Buffer[ 2 ] = 'l';
+		Buffer[ 3 ] = 'l';
+		return 4;
+	}
+
+	template<typename CharType>
+	FORCEINLINE bool IsDigit( CharType Character )
+	{
+		return Character >= '0' && Character <= '9';
+	}
+
+	template<typename CharType>
+	FORCEINLINE bool IsWhitespace( CharType Character )
+	{
+		return Character == ' ' || Character == '\n' || Character == '\r' || Character == '\t';
+	}
+
+	template<typename CharType>
+	FORCEINLINE void SkipWhitespace( const CharType*& Cursor, const CharType* End )
+	{
+		while ( Cursor < End && IsWhitespace( *Cursor ) )
+			Cursor++;
+	}
+
+	template<typename CharType>
+	struct TDecimal
+	{
+		const CharType* Start;
+		uint64 Mantissa;
+		int32 Exponent;
+		bool bNegative;
+		bool bTruncated;
+	};
+
+	// Scan a JSON number, keeping up to 19 significant digits.
+	template<typename CharType>
+	static bool ScanDecimal( const CharType*& Cursor, const CharType* End, TDecimal<CharType>& Decimal )
+	{
+		const CharType* P = Cursor;
+
+		Decimal.Start = P;
+		Decimal.Mantissa = 0;
+		Decimal.Exponent = 0;
+		Decimal.bNegative = false;
+		Decimal.bTruncated = false;
+
+		if ( P < End && *P == '-' )
+		{
+			Decimal.bNegative = true;
+			P++;
+		}
+
+		if ( P >= End || !IsDigit( *P ) )
+			return false;
+
+		int32 Digits = 0;
+		if ( *P == '0' )
+			P++;
+		else
+		{
+			while ( P < End && IsDigit( *P ) )
+			{
+				const uint32 Digit = *P++ - '0';
+				if ( Digits < 19 )
+				{
+					Decimal.Mantissa = Decimal.Mantissa * 10 + Digit;
+					Digits++;
+				}
+				else
+				{
+					Decimal.Exponent++;
+					Decimal.bTruncated |= Digit != 0;
+				}
+			}
+		}
+
+		if ( P < End && *P == '.' )
+		{
+			P++;
+			if ( P >= End || !IsDigit( *P ) )
+				return false;
+
+			while ( P < End && IsDigit( *P ) )
+			{
+				const uint32 Digit = *P++ - '0';
+				if ( Digits < 19 )
+				{
+					Decimal.Mantissa = Decimal.Mantissa * 10 + Digit;
+					Decimal.Exponent--;
+					if ( Decimal.Mantissa != 0 )
+						Digits++;
+				}
+				else
+					Decimal.bTruncated |= Digit != 0;
+			}
+		}
+
+		if ( P < End && ( *P == 'e' || *P == 'E' ) )
+		{
+			P++;
+
+			bool bNegativeExponent = false;
+			if ( P < End && ( *P == '+' || *P == '-' ) )
+				bNegativeExponent = *P++ == '-';
+
+			if ( P >= End || !IsDigit( *P ) )
+				return false;
+
+			int32 Power = 0;
+			while ( P < End && IsDigit( *P ) )
+			{
+				if ( Power < 100000 )
+					Power = Power * 10 + ( *P - '0' );
+				P++;
+			}
+
+			Decimal.Exponent += bNegativeExponent ? -Power : Power;
+		}
+
+		Cursor = P;
+		return true;
+	}
+
+	// Clinger's fast path: exact when both operands are exact doubles.
+	template<typename CharType>
+	FORCEINLINE bool TryFastDecimal( const TDecimal<CharType>& Decimal, double& Value )
+	{
+		if ( Decimal.bTruncated || Decimal.Mantissa > ( 1ull << 53 ) )
+			return false;
+		if ( Decimal.Exponent < -22 || Decimal.Exponent > 22 )
+			return false;
+
+		Value = (double)Decimal.Mantissa;
+		if ( Decimal.Exponent < 0 )
+			Value /= ExactPowersOfTen[ -Decimal.Exponent ];
+		else
+			Value *= ExactPowersOfTen[ Decimal.Exponent ];
+
+		if ( Decimal.bNegative )
+			Value = -Value;
+
+		return true;
+	}
+
+	// Fall back to the C runtime for inputs outside the fast path.
+	template<typename NumberType, typename CharType>
+	static NumberType ReadSlowDecimal( const TDecimal<CharType>& Decimal, const CharType* End )
+	{
+		const int32 Length = (int32)( End - Decimal.Start );
+
+		TArray<ANSICHAR, TInlineAllocator<64>> Buffer;
+		Buffer.SetNumUninitialized( Length + 1 );
+		for ( int32 i = 0; i < Length; i++ )
+			Buffer[ i ] = (ANSICHAR)Decimal.Start[ i ];
+		Buffer[ Length ] = 0;
+
+		if ( sizeof( NumberType ) == sizeof( float ) )
+			return (NumberType)strtof( Buffer.GetData(), nullptr );
+
+		return (NumberType)strtod( Buffer.GetData(), nullptr );
+	}
+
+	template<typename NumberType, int32 MaxChars, int32 ( *WriteNumber )( NumberType, TCHAR* )>
+	static void WriteArray( const NumberType* Data, int32 Num, FString& Text )
+	{
+		static const int32 BlockSize = 4096;
+
+		TArray<TCHAR>& Chars = Text.GetCharArray();
+		Chars.Reset( FMath::Min( Num, BlockSize ) * ( MaxChars + 1 ) + 3 );
+		Chars.Add( TEXT( '[' ) );
+
+		for ( int32 Block = 0; Block < Num; Block += BlockSize )
+		{
+			const int32 BlockEnd = FMath::Min( Block + BlockSize, Num );
+			const int32 Offset = Chars.Num();
+			Chars.SetNumUninitialized( Offset + ( BlockEnd - Block ) * ( MaxChars + 1 ), false );
+
+			TCHAR* Out = Chars.GetData() + Offset;
+			for ( int32 i = Block; i < BlockEnd; i++ )
+			{
+				if ( i > 0 )
+					*Out++ = TEXT( ',' );
+				Out += WriteNumber( Data[ i ], Out );
+			}
+
+			Chars.SetNumUninitialized( (int32)( Out - Chars.GetData() ), false );
+		}
+
+		Chars.Add( TEXT( ']' ) );
+		Chars.Add( TEXT( '\0' ) );
+	}
+
+	template<typename NumberType, bool ( *ReadNumber )( const TCHAR*&, const TCHAR*, NumberType& )>
+	static bool ReadArray( const TCHAR* Text, int32 Length, TArray<NumberType>& Array )
+	{
+		const TCHAR* Cursor = Text;
+		const TCHAR* End = Text + Length;
+
+		Array.Reset();
+
+		SkipWhitespace( Cursor, End );
+		if ( Cursor >= End || *Cursor++ != TEXT( '[' ) )
+			return false;
+
+		SkipWhitespace( Cursor, End );
+		if ( Cursor < End && *Cursor == TEXT( ']' ) )
+			Cursor++;
+		else
+		{
+			int32 Separators = 0;
+			for ( const TCHAR* P = Cursor; P < End; P++ )
+				Separators += *P == TEXT( ',' ) ? 1 : 0;
+
+			Array.Reserve( Separators + 1 );
+
+			while ( true )
+			{
+				SkipWhitespace( Cursor, End );
+
+				NumberType Value = 0;
+				if ( End - Cursor >= 4 && Cursor[ 0 ] == TEXT( 'n' ) && Cursor[ 1 ] == TEXT( 'u' ) && Cursor[ 2 ] == TEXT( 'l' ) && Cursor[ 3 ] == TEXT( 'l' ) )
+					Cursor += 4;
+				else if ( !ReadNumber( Cursor, End, Value ) )
+					return false;
+
+				Array.Add( Value );
+
+				SkipWhitespace( Cursor, End );
+				if ( Cursor >= End )
+					return false;
+
+				const TCHAR Separator = *Cursor++;
+				if ( Separator == TEXT( ']' ) )
+					break;
+				if ( Separator != TEXT( ',' ) )
+					return false;
+			}
+		}
+
+		SkipWhitespace( Cursor, End );
+		return Cursor == End;
+	}
+
+	template<typename CharType>
+	static int32 WriteInteger( int64 Value, CharType* Buffer )
+	{
+		CharType Digits[ 20 ];
+		int32 Count = 0;
+
+		uint64 Magnitude = Value < 0 ? 0 - (uint64)Value : (uint64)Value;
+		do
+		{
+			Digits[ 19 - Count++ ] = (CharType)( '0' + Magnitude % 10 );
+			Magnitude /= 10;
+		}
+		while ( Magnitude != 0 );
+
+		CharType* Out = Buffer;
+		if ( Value < 0 )
+			*Out++ = '-';
+
+		for ( int32 i = 20 - Count; i < 20; i++ )
+			*Out++ = Digits[ i ];
+
+		return (int32)( Out - Buffer );
+	}
+
+	template<typename CharType>
+	static int32 WriteFloat( float Value, CharType* Buffer )
+	{
+		uint32 Bits;
+		FMemory::Memcpy( &Bits, &Value, sizeof( Bits ) );
+
+		const bool bNegative = ( Bits >> 31 ) != 0;
+		const uint32 IeeeMantissa = Bits & ( ( 1u << 23 ) - 1 );
+		const uint32 IeeeExponent = ( Bits >> 23 ) & 0xFF;
+
+		if ( IeeeExponent == 0xFF )
+			return WriteNull( Buffer );
+
+		if ( IeeeExponent == 0 && IeeeMantissa == 0 )
+			return WriteDecimal( bNegative, 0, 0, Buffer );
+
+		uint32 Mantissa;
+		int32 Exponent;
+		FloatToDecimal( IeeeMantissa, IeeeExponent, Mantissa, Exponent );
+
+		return WriteDecimal( bNegative, Mantissa, Exponent, Buffer );
+	}
+
+	template<typename CharType>
+	static int32 WriteDouble( double Value, CharType* Buffer )
+	{
+		if ( !FMath::IsFinite( Value ) )
+			return WriteNull( Buffer );
+
+		// Small integers are written exactly by the float path.
+		if ( FMath::Abs( Value ) < 16777216.0 && FMath::RoundToDouble( Value ) == Value )
+			return WriteFloat( (float)Value, Buffer );
+
+		ANSICHAR Text[ FJsonLibraryNumberCodec::MaxDoubleChars ];
+		int32 Length = 0;
+		for ( int32 Precision = 15; Precision <= 17; Precision++ )
+		{
+			Length = snprintf( Text, FJsonLibraryNumberCodec::MaxDoubleChars, "%.*g", Precision, Value );
+			if ( strtod( Text, nullptr ) == Value )
+				break;
+		}
+
+		for ( int32 i = 0; i < Length; i++ )
+			Buffer[ i ] = (CharType)Text[ i ];
+
+		return Length;
+	}
+
+	template<typename CharType>
+	static bool ReadFloat( const CharType*& Cursor, const CharType* End, float& Value )
+	{
+		TDecimal<CharType> Decimal;
+		if ( !ScanDecimal( Cursor, End, Decimal ) )
+			return false;
+
+		double Number;
+		if ( TryFastDecimal( Decimal, Number ) )
+		{
+			// Rounding the exact double again is only wrong on a float halfway point.
+			uint64 Bits;
+			FMemory::Memcpy( &Bits, &Number, sizeof( Bits ) );
+			if ( ( Bits & 0x1FFFFFFF ) != 0x10000000 )
+			{
+				Value = (float)Number;
+				return true;
+			}
+		}
+
+		Value = ReadSlowDecimal<float>( Decimal, Cursor );
+		return true;
+	}
+
+	template<typename CharType>
+	static bool ReadDouble( const CharType*& Cursor, const CharType* End, double& Value )
+	{
+		TDecimal<CharType> Decimal;
+		if ( !ScanDecimal( Cursor, End, Decimal ) )
+			return false;
+
+		if ( !TryFastDecimal( Decimal, Value ) )
+			Value = ReadSlowDecimal<double>( Decimal, Cursor );
+
+		return true;
+	}
+}
+
+int32 FJsonLibraryNumberCodec::WriteFloat( float Value, TCHAR* Buffer )
+{
+	return JsonLibraryNumberCodec::WriteFloat( Value, Buffer );
+}
+
+int32 FJsonLibraryNumberCodec::WriteFloat( float Value, ANSICHAR* Buffer )
+{
+	return JsonLibraryNumberCodec::WriteFloat( Value, Buffer );
+}
+
+int32 FJsonLibraryNumberCodec::WriteDouble( double Value, TCHAR* Buffer )
+{
+	return JsonLibraryNumberCodec::WriteDouble( Value, Buffer );
+}
+
+int32 FJsonLibraryNumberCodec::WriteDouble( double Value, ANSICHAR* Buffer )
+{
+	return JsonLibraryNumberCodec::WriteDouble( Value, Buffer );
+}
+
+int32 FJsonLibraryNumberCodec::WriteInteger( int64 Value, TCHAR* Buffer )
+{
+	return JsonLibraryNumberCodec::WriteInteger( Value, Buffer );
+}
+
+int32 FJsonLibraryNumberCodec::WriteInteger( int64 Value, ANSICHAR* Buffer )
+{
+	return JsonLibraryNumberCodec::WriteInteger( Value, Buffer );
+}
+
+bool FJsonLibraryNumberCodec::ReadFloat( const TCHAR*& Cursor, const TCHAR* End, float& Value )
+{
+	return JsonLibraryNumberCodec::ReadFloat( Cursor, End, Value );
+}
+
+bool FJsonLibraryNumberCodec::ReadFloat( const ANSICHAR*& Cursor, const ANSICHAR* End, float& Value )
+{
+	return JsonLibraryNumberCodec::ReadFloat( Cursor, End, Value );
+}
+
+bool FJsonLibraryNumberCodec::ReadDouble( const TCHAR*& Cursor, const TCHAR* End, double& Value )
+{
+	return JsonLibraryNumberCodec::ReadDouble( Cursor, End, Value );
+}
+
+bool FJsonLibraryNumberCodec::ReadDouble( const ANSICHAR*& Cursor, const ANSICHAR* End, double& Value )
+{
+	return JsonLibraryNumberCodec::ReadDouble( Cursor, End, Value );
+}
+
+void FJsonLibraryNumberCodec::WriteFloatArray( const float* Data, int32 Num, FString& Text )
+{
+	JsonLibraryNumberCodec::WriteArray<float, MaxFloatChars, &FJsonLibraryNumberCodec::WriteFloat>( Data, Num, Text );
+}
+
+void FJsonLibraryNumberCodec::WriteDoubleArray( const double* Data, int32 Num, FString& Text )
+{
+	JsonLibraryNumberCodec::WriteArray<double, MaxDoubleChars, &FJsonLibraryNumberCodec::WriteDouble>( Data, Num, Text );
+}
+
+bool FJsonLibraryNumberCodec::ReadFloatArray( const TCHAR* Text, int32 Length, TArray<float>& Array )
+{
+	return JsonLibraryNumberCodec::ReadArray<float, &FJsonLibraryNumberCodec::ReadFloat>( Text, Length, Array );
+}
+
+bool FJsonLibraryNumberCodec::ReadDoubleArray( const TCHAR* Text, int32 Length, TArray<double>& Array )
+{
+	return JsonLibraryNumberCodec::ReadArray<double, &FJsonLibraryNumberCodec::ReadDouble>( Text, Length, Array );
+}
@@ -0,0 +1,39 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "CoreMinimal.h"
+
+// Text codec for numbers and contiguous numeric arrays, bypassing the DOM.
+struct FJsonLibraryNumberCodec
+{
+	// Maximum number of characters written for a single number.
+	static constexpr int32 MaxFloatChars   = 24;
+	static constexpr int32 MaxDoubleChars  = 32;
+	static constexpr int32 MaxIntegerChars = 20;
+
+	// Write the shortest text that reads back as the same float.
+	static int32 WriteFloat( float Value, TCHAR* Buffer );
+	static int32 WriteFloat( float Value, ANSICHAR* Buffer );
+	// Write the shortest text that reads back as the same double.
+	static int32 WriteDouble( double Value, TCHAR* Buffer );
+	static int32 WriteDouble( double Value, ANSICHAR* Buffer );
+	// Write an integer.
+	static int32 WriteInteger( int64 Value, TCHAR* Buffer );
+	static int32 WriteInteger( int64 Value, ANSICHAR* Buffer );
+
+	// Read a JSON number and advance the cursor past it.
+	static bool ReadFloat( const TCHAR*& Cursor, const TCHAR* End, float& Value );
+	static bool ReadFloat( const ANSICHAR*& Cursor, const ANSICHAR* End, float& Value );
+	// Read a JSON number and advance the cursor past it.
+	static bool ReadDouble( const TCHAR*& Cursor, const TCHAR* End, double& Value );
+	static bool ReadDouble( const ANSICHAR*& Cursor, const ANSICHAR* End, double& Value );
+
+	// Write an array of floats as a JSON array.
+	static void WriteFloatArray( const float* Data, int32 Num, FString& Text );
+	// Write an array of doubles as a JSON array.
+	static void WriteDoubleArray( const double* Data, int32 Num, FString& Text );
+
+	// Read a JSON array of numbers into an array of floats.
+	static bool ReadFloatArray( const TCHAR* Text, int32 Length, TArray<float>& Array );
+	// Read a JSON array of numbers into an array of doubles.
+	static bool ReadDoubleArray( const TCHAR* Text, int32 Length, TArray<double>& Array );
+};
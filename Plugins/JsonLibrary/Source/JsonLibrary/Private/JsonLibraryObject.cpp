@@ -3,9 +3,37 @@
 #include "JsonLibraryConverter.h"
 #include "JsonLibraryList.h"
 #include "JsonLibraryHelpers.h"
+#include "JsonLibraryCbor.h"
+#include "JsonLibraryPatch.h"
+#include "JsonLibraryIndex.h"
 #include "Policies/CondensedJsonPrintPolicy.h"
 #include "Policies/PrettyJsonPrintPolicy.h"
 
+// Strict equality for change notifications, compared in place without wrapping either value.
+static bool NotifyEquals( const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B )
+{
+	if ( A == B )
+		return true;
+
+	const EJson TypeA = A.IsValid() ? A->Type : EJson::None;
+	const EJson TypeB = B.IsValid() ? B->Type : EJson::None;
+	if ( TypeA != TypeB )
+		return false;
+
+	switch ( TypeA )
+	{
+		case EJson::None:
+		case EJson::Null:    return true;
+		case EJson::Boolean: return A->AsBool() == B->AsBool();
+		case EJson::Number:  return A->AsNumber() == B->AsNumber();
+		case EJson::String:  return A->AsString().Equals( B->AsString(), ESearchCase::CaseSensitive );
+		case EJson::Object:  return A->AsObject() == B->AsObject() || FJsonLibraryValue( A ).Equals( FJsonLibraryValue( B ), true );
+		case EJson::Array:   return &A->AsArray() == &B->AsArray() || FJsonLibraryValue( A ).Equals( FJsonLibraryValue( B ), true );
+	}
+
+	return false;
+}
+
 FJsonLibraryObject::FJsonLibraryObject( const TSharedPtr<FJsonValue>& Value )
 {
 	if ( Value.IsValid() && Value->Type == EJson::Object )
@@ -54,12 +82,26 @@ FJsonLibraryObject::FJsonLibraryObject()
 	JsonObject = MakeShareable( new FJsonValueObject( MakeShareable( new FJsonObject() ) ) );
 }
 
+FJsonLibraryObject::FJsonLibraryObject( const FJsonLibraryObject& Object )
+	: JsonObject( Object.JsonObject )
+	, OnNotify( Object.OnNotify )
+	, OnBatchNotify( Object.OnBatchNotify )
+	, bNotifyHasKey( false )
+{
+}
+
 FJsonLibraryObject::FJsonLibraryObject( const FJsonLibraryObjectNotify& Notify )
 	: FJsonLibraryObject()
 {
 	OnNotify = Notify;
 }
 
+FJsonLibraryObject::FJsonLibraryObject( const FJsonLibraryObjectBatchNotify& Notify )
+	: FJsonLibraryObject()
+{
+	OnBatchNotify = Notify;
+}
+
 FJsonLibraryObject::FJsonLibraryObject( const FLinearColor& Value )
 	: FJsonLibraryObject()
 {
@@ -317,86 +359,149 @@ void FJsonLibraryObject::RemoveKey( const FString& Key )
 	NotifyRemove( Key );
 }
 
+void FJsonLibraryObject::BeginNotifyBatch()
+{
+	NotifyBatchDepth++;
+}
+
+bool FJsonLibraryObject::IsNotifyBatching() const
+{
+	return NotifyBatchDepth > 0;
+}
+
+void FJsonLibraryObject::EndNotifyBatch()
+{
+	if ( NotifyBatchDepth <= 0 || --NotifyBatchDepth > 0 )
+		return;
+
+	TArray<FJsonLibraryObjectChange> Changes = MoveTemp( NotifyChanges );
+	NotifyChanges.Reset();
+	NotifyChangeIndex.Reset();
+
+	if ( Changes.Num() == 0 )
+		return;
+
+	const FJsonLibraryValue Object( *this );
+	if ( OnNotify.IsBound() )
+	{
+		for ( const FJsonLibraryObjectChange& Change : Changes )
+			OnNotify.Execute( Object, Change.Action, Change.Key, Change.Value );
+	}
+
+	if ( OnBatchNotify.IsBound() )
+	{
+		Changes.RemoveAll( []( const FJsonLibraryObjectChange& Change ) { return Change.Action == EJsonLibraryNotifyAction::None; } );
+		if ( Changes.Num() > 0 )
+			OnBatchNotify.Execute( Object, Changes );
+	}
+}
+
 void FJsonLibraryObject::Add( const FJsonLibraryObject& Object )
 {
 	const TSharedPtr<FJsonObject> ObjectJson = Object.GetJsonObject();
 	if ( !ObjectJson.IsValid() )
 		return;
 
+	BeginNotifyBatch();
 	for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : ObjectJson->Values )
 		SetValue( Temp.Key, FJsonLibraryValue( Temp.Value ) );
+	EndNotifyBatch();
 }
 
 void FJsonLibraryObject::AddBooleanMap( const TMap<FString, bool>& Map )
 {
+	BeginNotifyBatch();
 	for ( const TPair<FString, bool>& Temp : Map )
 		SetValue( Temp.Key, FJsonLibraryValue( Temp.Value ) );
+	EndNotifyBatch();
 }
 
 void FJsonLibraryObject::AddFloatMap( const TMap<FString, float>& Map )
 {
+	BeginNotifyBatch();
 	for ( const TPair<FString, float>& Temp : Map )
 		SetValue( Temp.Key, FJsonLibraryValue( Temp.Value ) );
+	EndNotifyBatch();
 }
 
 void FJsonLibraryObject::AddIntegerMap( const TMap<FString, int32>& Map )
 {
+	BeginNotifyBatch();
 	for ( const TPair<FString, int32>& Temp : Map )
 		SetValue( Temp.Key, FJsonLibraryValue( Temp.Value ) );
+	EndNotifyBatch();
 }
 
 void FJsonLibraryObject::AddNumberMap( const TMap<FString, double>& Map )
 {
+	BeginNotifyBatch();
 	for ( const TPair<FString, double>& Temp : Map )
 		SetValue( Temp.Key, FJsonLibraryValue( Temp.Value ) );
+	EndNotifyBatch();
 }
 
 void FJsonLibraryObject::AddStringMap( const TMap<FString, FString>& Map )
 {
+	BeginNotifyBatch();
 	for ( const TPair<FString, FString>& Temp : Map )
 		SetValue( Temp.Key, FJsonLibraryValue( Temp.Value ) );
+	EndNotifyBatch();
 }
 
 void FJsonLibraryObject::AddDateTimeMap( const TMap<FString, FDateTime>& Map )
 {
+	BeginNotifyBatch();
 	for ( const TPair<FString, FDateTime>& Temp : Map )
 		SetValue( Temp.Key, FJsonLibraryValue( Temp.Value ) );
+	EndNotifyBatch();
 }
 
 void FJsonLibraryObject::AddGuidMap( const TMap<FString, FGuid>& Map )
 {
+	BeginNotifyBatch();
 	for ( const TPair<FString, FGuid>& Temp : Map )
 		SetValue( Temp.Key, FJsonLibraryValue( Temp.Value ) );
+	EndNotifyBatch();
 }
 
 void FJsonLibraryObject::AddColorMap( const TMap<FString, FColor>& Map )
 {
+	BeginNotifyBatch();
 	for ( const TPair<FString, FColor>& Temp : Map )
 		SetValue( Temp.Key, FJsonLibraryValue( Temp.Value ) );
+	EndNotifyBatch();
 }
 
 void FJsonLibraryObject::AddLinearColorMap( const TMap<FString, FLinearColor>& Map )
 {
+	BeginNotifyBatch();
 	for ( const TPair<FString, FLinearColor>& Temp : Map )
 		SetValue( Temp.Key, FJsonLibraryValue( Temp.Value ) );
+	EndNotifyBatch();
 }
 
 void FJsonLibraryObject::AddRotatorMap( const TMap<FString, FRotator>& Map )
 {
+	BeginNotifyBatch();
 	for ( const TPair<FString, FRotator>& Temp : Map )
 		SetValue( Temp.Key, FJsonLibraryValue( Temp.Value ) );
+	EndNotifyBatch();
 }
 
 void FJsonLibraryObject::AddTransformMap( const TMap<FString, FTransform>& Map )
 {
+	BeginNotifyBatch();
 	for ( const TPair<FString, FTransform>& Temp : Map )
 		SetValue( Temp.Key, FJsonLibraryValue( Temp.Value ) );
+	EndNotifyBatch();
 }
 
 void FJsonLibraryObject::AddVectorMap( const TMap<FString, FVector>& Map )
 {
+	BeginNotifyBatch();
 	for ( const TPair<FString, FVector>& Temp : Map )
 		SetValue( Temp.Key, FJsonLibraryValue( Temp.Value ) );
+	EndNotifyBatch();
 }
 
 TArray<FString> FJsonLibraryObject::GetKeys() const
@@ -619,7 +724,13 @@ const TSharedPtr<FJsonObject> FJsonLibraryObject::GetJsonObject() const
 
 TSharedPtr<FJsonObject> FJsonLibraryObject::SetJsonObject()
 {
-	return GetJsonObject();
+	TSharedPtr<FJsonObject> Json = GetJsonObject();
+
+	// an object only this handle holds cannot be inside an indexed list
+	if ( Json.IsValid() && !( JsonObject.IsUnique() && Json.GetSharedReferenceCount() == 2 ) )
+		FJsonLibraryIndex::Touch();
+
+	return Json;
 }
 
 bool FJsonLibraryObject::TryParse( const FString& Text, bool bStripComments /*= false*/, bool bStripTrailingCommas /*= false*/ )
@@ -676,20 +787,79 @@ bool FJsonLibraryObject::TryStringify( FString& Text, bool bCondensed /*= true*/
 	return true;
 }
 
-void FJsonLibraryObject::NotifyAddOrChange( const FString& Key, const FJsonLibraryValue& Value )
+bool FJsonLibraryObject::IsNotifyBound() const
 {
-	if ( !OnNotify.IsBound() )
+	return OnNotify.IsBound() || OnBatchNotify.IsBound();
+}
+
+void FJsonLibraryObject::NotifyExecute( EJsonLibraryNotifyAction Action, const FString& Key, const TSharedPtr<FJsonValue>& Value )
+{
+	if ( NotifyBatchDepth <= 0 )
+	{
+		if ( OnNotify.IsBound() )
+			OnNotify.Execute( FJsonLibraryValue( *this ), Action, Key, FJsonLibraryValue( Value ) );
+
+		if ( OnBatchNotify.IsBound() && Action != EJsonLibraryNotifyAction::None )
+		{
+			TArray<FJsonLibraryObjectChange> Changes;
+			FJsonLibraryObjectChange& Change = Changes.AddDefaulted_GetRef();
+			Change.Action = Action;
+			Change.Key = Key;
+			Change.Value = FJsonLibraryValue( Value );
+
+			OnBatchNotify.Execute( FJsonLibraryValue( *this ), Changes );
+		}
+
 		return;
+	}
 
-	if ( bNotifyHasKey )
+	// a reset supersedes everything collected so far
+	if ( Action == EJsonLibraryNotifyAction::Reset )
 	{
-		if ( !Value.Equals( FJsonLibraryValue( NotifyValue ), true ) )
-			OnNotify.Execute( FJsonLibraryValue( *this ), EJsonLibraryNotifyAction::Changed, Key, Value );
-		else
-			OnNotify.Execute( FJsonLibraryValue( *this ), EJsonLibraryNotifyAction::None, Key, Value );
+		NotifyChanges.Reset();
+		NotifyChangeIndex.Reset();
+	}
+	else if ( const int32* Index = NotifyChangeIndex.Find( Key ) )
+	{
+		// fold repeated changes to a property into its net change
+		FJsonLibraryObjectChange& Change = NotifyChanges[ *Index ];
+		switch ( Action )
+		{
+			case EJsonLibraryNotifyAction::None:
+				return;
+			case EJsonLibraryNotifyAction::Added:
+				Change.Action = Change.Action == EJsonLibraryNotifyAction::Removed ? EJsonLibraryNotifyAction::Changed : EJsonLibraryNotifyAction::Added;
+				break;
+			case EJsonLibraryNotifyAction::Changed:
+				if ( Change.Action != EJsonLibraryNotifyAction::Added )
+					Change.Action = EJsonLibraryNotifyAction::Changed;
+				break;
+			case EJsonLibraryNotifyAction::Removed:
+				Change.Action = Change.Action == EJsonLibraryNotifyAction::Added ? EJsonLibraryNotifyAction::None : EJsonLibraryNotifyAction::Removed;
+				break;
+		}
+
+		Change.Value = FJsonLibraryValue( Value );
+		return;
 	}
 	else
-		OnNotify.Execute( FJsonLibraryValue( *this ), EJsonLibraryNotifyAction::Added, Key, Value );
+		NotifyChangeIndex.Add( Key, NotifyChanges.Num() );
+
+	FJsonLibraryObjectChange& Change = NotifyChanges.AddDefaulted_GetRef();
+	Change.Action = Action;
+	Change.Key = Key;
+	Change.Value = FJsonLibraryValue( Value );
+}
+
+void FJsonLibraryObject::NotifyAddOrChange( const FString& Key, const FJsonLibraryValue& Value )
+{
+	if ( !IsNotifyBound() )
+		return;
+
+	if ( bNotifyHasKey )
+		NotifyExecute( NotifyEquals( Value.JsonValue, NotifyValue ) ? EJsonLibraryNotifyAction::None : EJsonLibraryNotifyAction::Changed, Key, Value.JsonValue );
+	else
+		NotifyExecute( EJsonLibraryNotifyAction::Added, Key, Value.JsonValue );
 
 	bNotifyHasKey = false;
 	NotifyValue.Reset();
@@ -697,7 +867,7 @@ void FJsonLibraryObject::NotifyAddOrChange( const FString& Key, const FJsonLibra
 
 bool FJsonLibraryObject::NotifyCheck()
 {
-	if ( !OnNotify.IsBound() )
+	if ( !IsNotifyBound() )
 		return false;
 
 	const TSharedPtr<FJsonObject> Json = GetJsonObject();
@@ -712,39 +882,38 @@ bool FJsonLibraryObject::NotifyCheck()
 
 bool FJsonLibraryObject::NotifyCheck( const FString& Key )
 {
-	if ( !OnNotify.IsBound() )
+	if ( !IsNotifyBound() )
 		return false;
 
+	NotifyValue.Reset();
+
 	const TSharedPtr<FJsonObject> Json = GetJsonObject();
-	if ( Json.IsValid() )
-		bNotifyHasKey = Json->HasField( Key );
-	else
-		bNotifyHasKey = false;
+	const TSharedPtr<FJsonValue>* Field = Json.IsValid() ? Json->Values.Find( Key ) : nullptr;
 
-	NotifyValue.Reset();
+	bNotifyHasKey = Field && Field->IsValid();
 	if ( bNotifyHasKey )
-		NotifyValue = Json->TryGetField( Key );
+		NotifyValue = *Field;
 
 	return bNotifyHasKey;
 }
 
 void FJsonLibraryObject::NotifyClear()
 {
-	if ( !OnNotify.IsBound() )
+	if ( !IsNotifyBound() )
 		return;
 
 	NotifyValue.Reset();
 	if ( bNotifyHasKey )
-		OnNotify.Execute( FJsonLibraryValue( *this ), EJsonLibraryNotifyAction::Reset, FString(), FJsonLibraryValue( TSharedPtr<FJsonValue>() ) );
+		NotifyExecute( EJsonLibraryNotifyAction::Reset, FString(), TSharedPtr<FJsonValue>() );
 	else
-		OnNotify.Execute( FJsonLibraryValue( *this ), EJsonLibraryNotifyAction::None, FString(), FJsonLibraryValue( TSharedPtr<FJsonValue>() ) );
+		NotifyExecute( EJsonLibraryNotifyAction::None, FString(), TSharedPtr<FJsonValue>() );
 
 	bNotifyHasKey = false;
 }
 
 void FJsonLibraryObject::NotifyParse()
 {
-	if ( !OnNotify.IsBound() )
+	if ( !IsNotifyBound() )
 		return;
 
 	const TSharedPtr<FJsonObject> Json = GetJsonObject();
@@ -752,21 +921,24 @@ void FJsonLibraryObject::NotifyParse()
 		return;
 
 	NotifyValue.Reset();
+
+	BeginNotifyBatch();
 	for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : Json->Values )
-		OnNotify.Execute( FJsonLibraryValue( *this ), EJsonLibraryNotifyAction::Added, Temp.Key, FJsonLibraryValue( Temp.Value ) );
+		NotifyExecute( EJsonLibraryNotifyAction::Added, Temp.Key, Temp.Value );
+	EndNotifyBatch();
 
 	bNotifyHasKey = false;
 }
 
 void FJsonLibraryObject::NotifyRemove( const FString& Key )
 {
-	if ( !OnNotify.IsBound() )
+	if ( !IsNotifyBound() )
 		return;
 
 	if ( bNotifyHasKey )
-		OnNotify.Execute( FJsonLibraryValue( *this ), EJsonLibraryNotifyAction::Removed, Key, FJsonLibraryValue( NotifyValue ) );
+		NotifyExecute( EJsonLibraryNotifyAction::Removed, Key, NotifyValue );
 	else
-		OnNotify.Execute( FJsonLibraryValue( *this ), EJsonLibraryNotifyAction::None, Key, FJsonLibraryValue( TSharedPtr<FJsonValue>() ) );
+		NotifyExecute( EJsonLibraryNotifyAction::None, Key, TSharedPtr<FJsonValue>() );
 
 	bNotifyHasKey = false;
 	NotifyValue.Reset();
@@ -902,6 +1074,212 @@ FString FJsonLibraryObject::Stringify( bool bCondensed /*= true*/ ) const
 	return FString();
 }
 
+bool FJsonLibraryObject::TryParseCbor( const TArray<uint8>& Data )
+{
+	if ( Data.Num() <= 0 )
+		return false;
+
+	TSharedPtr<FJsonValue> Value;
+	FJsonLibraryCborReader Reader( Data.GetData(), Data.Num() );
+	if ( !Reader.ReadValue( Value ) || !Reader.IsDone() || Value->Type != EJson::Object )
+		return false;
+
+	JsonObject = StaticCastSharedPtr<FJsonValueObject>( Value );
+
+	NotifyParse();
+	return true;
+}
+
+FJsonLibraryObject FJsonLibraryObject::ParseCbor( const TArray<uint8>& Data )
+{
+	FJsonLibraryObject Object = TSharedPtr<FJsonValueObject>();
+	if ( !Object.TryParseCbor( Data ) )
+		Object.JsonObject.Reset();
+
+	return Object;
+}
+
+FJsonLibraryObject FJsonLibraryObject::ParseCbor( const TArray<uint8>& Data, const FJsonLibraryObjectNotify& Notify )
+{
+	FJsonLibraryObject Object = ParseCbor( Data );
+	Object.OnNotify = Notify;
+
+	return Object;
+}
+
+TArray<uint8> FJsonLibraryObject::EncodeCbor( bool bTypedArrays /*= true*/ ) const
+{
+	TArray<uint8> Data;
+	if ( !GetJsonObject().IsValid() )
+		return Data;
+
+	FJsonLibraryCborWriter Writer( Data, bTypedArrays );
+	Writer.WriteValue( JsonObject );
+
+	return Data;
+}
+
+FJsonLibraryList FJsonLibraryObject::CreatePatch( const FJsonLibraryObject& Target ) const
+{
+	if ( !GetJsonObject().IsValid() || !Target.GetJsonObject().IsValid() )
+		return FJsonLibraryList( TSharedPtr<FJsonValueArray>() );
+
+	FString Path;
+	TArray<TSharedPtr<FJsonValue>> Patch;
+	FJsonLibraryPatch::Diff( JsonObject, Target.JsonObject, Path, Patch );
+
+	TSharedPtr<FJsonValueArray> Array = MakeShareable( new FJsonValueArray( Patch ) );
+	return FJsonLibraryList( Array );
+}
+
+bool FJsonLibraryObject::ApplyPatch( const FJsonLibraryList& Patch )
+{
+	const TArray<TSharedPtr<FJsonValue>>* Operations = Patch.GetJsonArray();
+	if ( !Operations || !SetJsonObject().IsValid() )
+		return false;
+
+	// operations are applied in place, up to the first one that fails, and notified as one batch
+	TSharedPtr<FJsonValue> Root = JsonObject;
+	BeginNotifyBatch();
+	for ( const TSharedPtr<FJsonValue>& Operation : *Operations )
+	{
+		if ( !IsNotifyBound() )
+		{
+			if ( !FJsonLibraryPatch::Apply( Root, Operation ) )
+			{
+				EndNotifyBatch();
+				return false;
+			}
+			if ( Root != JsonObject )
+			{
+				if ( Root->Type != EJson::Object )
+				{
+					EndNotifyBatch();
+					return false;
+				}
+
+				JsonObject = StaticCastSharedPtr<FJsonValueObject>( Root );
+			}
+
+			continue;
+		}
+
+		// find the properties of this object that the operation touches
+		FString Op;
+		TArray<FString> Keys;
+		bool bRoot = false;
+
+		const TSharedPtr<FJsonObject>* Object;
+		if ( Operation.IsValid() && Operation->TryGetObject( Object ) && Object && Object->IsValid() )
+		{
+			( *Object )->TryGetStringField( TEXT( "op" ), Op );
+
+			FString Pointer;
+			TArray<FString> Tokens;
+			if ( ( *Object )->TryGetStringField( TEXT( "path" ), Pointer ) && FJsonLibraryPatch::ParsePointer( Pointer, Tokens ) )
+			{
+				if ( Tokens.Num() > 0 )
+					Keys.AddUnique( Tokens[ 0 ] );
+				else
+					bRoot = true;
+			}
+			if ( Op == TEXT( "move" ) && ( *Object )->TryGetStringField( TEXT( "from" ), Pointer ) && FJsonLibraryPatch::ParsePointer( Pointer, Tokens ) && Tokens.Num() > 0 )
+				Keys.AddUnique( Tokens[ 0 ] );
+		}
+
+		TArray<TSharedPtr<FJsonValue>> Previous;
+		for ( const FString& Key : Keys )
+			Previous.Add( GetJsonObject()->Values.FindRef( Key ) );
+
+		if ( bRoot )
+			NotifyCheck();
+
+		if ( !FJsonLibraryPatch::Apply( Root, Operation ) )
+		{
+			EndNotifyBatch();
+			return false;
+		}
+		if ( Root != JsonObject )
+		{
+			if ( Root->Type != EJson::Object )
+			{
+				EndNotifyBatch();
+				return false;
+			}
+
+			JsonObject = StaticCastSharedPtr<FJsonValueObject>( Root );
+		}
+
+		if ( bRoot )
+		{
+			NotifyClear();
+			NotifyParse();
+			continue;
+		}
+		if ( Op == TEXT( "test" ) )
+			continue;
+
+		const TSharedPtr<FJsonObject> Json = GetJsonObject();
+		for ( int32 i = 0; i < Keys.Num(); i++ )
+		{
+			const TSharedPtr<FJsonValue> Value = Json->Values.FindRef( Keys[ i ] );
+			if ( Value.IsValid() )
+				NotifyExecute( Previous[ i ].IsValid() ? EJsonLibraryNotifyAction::Changed : EJsonLibraryNotifyAction::Added, Keys[ i ], Value );
+			else if ( Previous[ i ].IsValid() )
+				NotifyExecute( EJsonLibraryNotifyAction::Removed, Keys[ i ], Previous[ i ] );
+		}
+	}
+
+	EndNotifyBatch();
+	return true;
+}
+
+FJsonLibraryObject FJsonLibraryObject::CreateMergePatch( const FJsonLibraryObject& Target ) const
+{
+	if ( !GetJsonObject().IsValid() || !Target.GetJsonObject().IsValid() )
+		return FJsonLibraryObject( TSharedPtr<FJsonValueObject>() );
+
+	const TSharedPtr<FJsonValue> Patch = FJsonLibraryPatch::MergeDiff( JsonObject, Target.JsonObject );
+	if ( !Patch.IsValid() )
+		return FJsonLibraryObject();
+
+	return FJsonLibraryObject( Patch );
+}
+
+bool FJsonLibraryObject::ApplyMergePatch( const FJsonLibraryObject& Patch )
+{
+	const TSharedPtr<FJsonObject> PatchJson = Patch.GetJsonObject();
+	TSharedPtr<FJsonObject> Json = SetJsonObject();
+	if ( !PatchJson.IsValid() || !Json.IsValid() )
+		return false;
+
+	// top level properties go through the notify hooks, nested objects are merged in place
+	BeginNotifyBatch();
+	for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : PatchJson->Values )
+	{
+		if ( FJsonLibraryPatch::IsNull( Temp.Value ) )
+		{
+			if ( Json->HasField( Temp.Key ) )
+				RemoveKey( Temp.Key );
+
+			continue;
+		}
+
+		const TSharedPtr<FJsonValue> Value = Json->Values.FindRef( Temp.Key );
+		if ( Value.IsValid() && Value->Type == EJson::Object && Temp.Value->Type == EJson::Object )
+		{
+			FJsonLibraryPatch::MergeApply( Value, Temp.Value );
+			if ( IsNotifyBound() )
+				NotifyExecute( EJsonLibraryNotifyAction::Changed, Temp.Key, Value );
+		}
+		else
+			SetValue( Temp.Key, FJsonLibraryValue( FJsonLibraryPatch::MergeApply( TSharedPtr<FJsonValue>(), Temp.Value ) ) );
+	}
+	EndNotifyBatch();
+
+	return true;
+}
+
 
 bool FJsonLibraryObject::ToStruct( const UStruct* StructType, void* StructPtr ) const
 {
@@ -997,6 +1375,17 @@ TMap<FString, FJsonLibraryValue> FJsonLibraryObject::ToMap() const
 	return Map;
 }
 
+FJsonLibraryObject::FConstIterator FJsonLibraryObject::begin() const
+{
+	const TSharedPtr<FJsonObject> Json = GetJsonObject();
+	return FConstIterator( Json.IsValid() ? &Json->Values : nullptr );
+}
+
+FJsonLibraryObject::FConstIterator FJsonLibraryObject::end() const
+{
+	return FConstIterator( nullptr );
+}
+
 TMap<FString, bool> FJsonLibraryObject::ToBooleanMap() const
 {
 	const TSharedPtr<FJsonObject> Json = GetJsonObject();
@@ -1165,6 +1554,25 @@ TMap<FString, FVector> FJsonLibraryObject::ToVectorMap() const
 	return Map;
 }
 
+FJsonLibraryObject& FJsonLibraryObject::operator=( const FJsonLibraryObject& Object )
+{
+	if ( this == &Object )
+		return *this;
+
+	JsonObject    = Object.JsonObject;
+	OnNotify      = Object.OnNotify;
+	OnBatchNotify = Object.OnBatchNotify;
+
+	// a batch belongs to the handle that opened it
+	bNotifyHasKey    = false;
+	NotifyValue.Reset();
+	NotifyBatchDepth = 0;
+	NotifyChanges.Reset();
+	NotifyChangeIndex.Reset();
+
+	return *this;
+}
+
 bool FJsonLibraryObject::operator==( const FJsonLibraryObject& Object ) const
 {
 	return Equals( Object );
@@ -0,0 +1,530 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibraryPatch.h"
+
+namespace JsonLibraryPatch
+{
+	static TArray<TSharedPtr<FJsonValue>>* GetMutableArray( const TSharedPtr<FJsonValue>& Value )
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Array;
+		if ( Value.IsValid() && Value->TryGetArray( Array ) )
+			return const_cast<TArray<TSharedPtr<FJsonValue>>*>( Array );
+
+		return nullptr;
+	}
+
+	static FJsonObject* GetMutableObject( const TSharedPtr<FJsonValue>& Value )
+	{
+		if ( Value.IsValid() && Value->Type == EJson::Object && Value->AsObject().IsValid() )
+			return Value->AsObject().Get();
+
+		return nullptr;
+	}
+
+	static bool ParseIndex( const FString& Token, int32& Index )
+	{
+		const int32 Length = Token.Len();
+		if ( Length <= 0 || Length > 9 || ( Length > 1 && Token[ 0 ] == TCHAR( '0' ) ) )
+			return false;
+
+		Index = 0;
+		for ( int32 i = 0; i < Length; i++ )
+		{
+			const TCHAR Char = Token[ i ];
+			if ( Char < TCHAR( '0' ) || Char > TCHAR( '9' ) )
+				return false;
+
+			Index = Index * 10 + ( Char - TCHAR( '0' ) );
+		}
+
+		return true;
+	}
+
+	static TSharedPtr<FJsonValue> MakeOperation( const TCHAR* Op, const FString& Path, const TSharedPtr<FJsonValue>& Value )
+	{
+		TSharedPtr<FJsonObject> Operation = MakeShareable( new FJsonObject() );
+		Operation->SetStringField( TEXT( "op" ), Op );
+		Operation->SetStringField( TEXT( "path" ), Path );
+		if ( Value.IsValid() )
+			Operation->SetField( TEXT( "value" ), Value );
+
+		return MakeShareable( new FJsonValueObject( Operation ) );
+	}
+
+	// Find the value a pointer refers to.
+	static TSharedPtr<FJsonValue> Resolve( const TSharedPtr<FJsonValue>& Root, const TArray<FString>& Tokens, int32 Num )
+	{
+		TSharedPtr<FJsonValue> Value = Root;
+		for ( int32 i = 0; i < Num && Value.IsValid(); i++ )
+		{
+			if ( FJsonObject* Object = GetMutableObject( Value ) )
+			{
+				const TSharedPtr<FJsonValue>* Field = Object->Values.Find( Tokens[ i ] );
+				Value = Field ? *Field : TSharedPtr<FJsonValue>();
+			}
+			else if ( TArray<TSharedPtr<FJsonValue>>* Array = GetMutableArray( Value ) )
+			{
+				int32 Index;
+				if ( !ParseIndex( Tokens[ i ], Index ) || Index >= Array->Num() )
+					return TSharedPtr<FJsonValue>();
+
+				Value = ( *Array )[ Index ];
+			}
+			else
+				return TSharedPtr<FJsonValue>();
+		}
+
+		return Value;
+	}
+
+	static bool Add( TSharedPtr<FJsonValue>& Root, const TArray<FString>& Tokens, const TSharedPtr<FJsonValue>& Value )
+	{
+		if ( Tokens.Num() == 0 )
+		{
+			Root = Value;
+			return true;
+		}
+
+		const TSharedPtr<FJsonValue> Parent = Resolve( Root, Tokens, Tokens.Num() - 1 );
+		const FString& Token = Tokens.Last();
+
+		if ( FJsonObject* Object = GetMutableObject( Parent ) )
+		{
+			Object->SetField( Token, Value );
+			return true;
+		}
+		if ( TArray<TSharedPtr<FJsonValue>>* Array = GetMutableArray( Parent ) )
+		{
+			if ( Token == TEXT( "-" ) )
+			{
+				Array->Add( Value );
+				return true;
+			}
+
+			int32 Index;
+			if ( !ParseIndex( Token, Index ) || Index > Array->Num() )
+				return false;
+
+			Array->Insert( Value, Index );
+			return true;
+		}
+
+		return false;
+	}
+
+	static bool Remove( TSharedPtr<FJsonValue>& Root, const TArray<FString>& Tokens )
+	{
+		if ( Tokens.Num() == 0 )
+			return false;
+
+		const TSharedPtr<FJsonValue> Parent = Resolve( Root, Tokens, Tokens.Num() - 1 );
+		const FString& Token = Tokens.Last();
+
+		if ( FJsonObject* Object = GetMutableObject( Parent ) )
+			return Object->Values.Remove( Token ) > 0;
+
+		if ( TArray<TSharedPtr<FJsonValue>>* Array = GetMutableArray( Parent ) )
+		{
+			int32 Index;
+			if ( !ParseIndex( Token, Index ) || Index >= Array->Num() )
+				return false;
+
+			Array->RemoveAt( Index );
+			return true;
+		}
+
+		return false;
+	}
+
+	static bool Replace( TSharedPtr<FJsonValue>& Root, const TArray<FString>& Tokens, const TSharedPtr<FJsonValue>& Value )
+	{
+		if ( Tokens.Num() == 0 )
+		{
+			Root = Value;
+			return true;
+		}
+
+		const TSharedPtr<FJsonValue> Parent = Resolve( Root, Tokens, Tokens.Num() - 1 );
+		const FString& Token = Tokens.Last();
+
+		if ( FJsonObject* Object = GetMutableObject( Parent ) )
+		{
+			TSharedPtr<FJsonValue>* Field = Object->Values.Find( Token );
+			if ( !Field )
+				return false;
+
+			*Field = Value;
+			return true;
+		}
+		if ( TArray<TSharedPtr<FJsonValue>>* Array = GetMutableArray( Parent ) )
+		{
+			int32 Index;
+			if ( !ParseIndex( Token, Index ) || Index >= Array->Num() )
+				return false;
+
+			( *Array )[ Index ] = Value;
+			return true;
+		}
+
+		return false;
+	}
+}
+
+bool FJsonLibraryPatch::DeepEquals( const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B )
+{
+	if ( A == B )
+		return true;
+
+	if ( IsNull( A ) || IsNull( B ) )
+		return IsNull( A ) && IsNull( B );
+
+	if ( A->Type != B->Type )
+		return false;
+
+	switch ( A->Type )
+	{
+		case EJson::Boolean: return A->AsBool()   == B->AsBool();
+		case EJson::Number:  return A->AsNumber() == B->AsNumber();
+		case EJson::String:  return A->AsString().Equals( B->AsString(), ESearchCase::CaseSensitive );
+		case EJson::Array:
+		{
+			const TArray<TSharedPtr<FJsonValue>>& ArrayA = A->AsArray();
+			const TArray<TSharedPtr<FJsonValue>>& ArrayB = B->AsArray();
+			if ( ArrayA.Num() != ArrayB.Num() )
+				return false;
+
+			for ( int32 i = 0; i < ArrayA.Num(); i++ )
+			{
+				if ( !DeepEquals( ArrayA[ i ], ArrayB[ i ] ) )
+					return false;
+			}
+
+			return true;
+		}
+		case EJson::Object:
+		{
+			const TSharedPtr<FJsonObject>& ObjectA = A->AsObject();
+			const TSharedPtr<FJsonObject>& ObjectB = B->AsObject();
+			if ( ObjectA == ObjectB )
+				return true;
+			if ( !ObjectA.IsValid() || !ObjectB.IsValid() || ObjectA->Values.Num() != ObjectB->Values.Num() )
+				return false;
+
+			for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : ObjectA->Values )
+			{
+				const TSharedPtr<FJsonValue>* Field = ObjectB->Values.Find( Temp.Key );
+				if ( !Field || !DeepEquals( Temp.Value, *Field ) )
+					return false;
+			}
+
+			return true;
+		}
+	}
+
+	return true;
+}
+
+TSharedPtr<FJsonValue> FJsonLibraryPatch::DeepCopy( const TSharedPtr<FJsonValue>& Value )
+{
+	if ( !Value.IsValid() )
+		return Value;
+
+	if ( Value->Type == EJson::Array )
+	{
+		const TArray<TSharedPtr<FJsonValue>>& Array = Value->AsArray();
+
+		TArray<TSharedPtr<FJsonValue>> Copy;
+		Copy.Reserve( Array.Num() );
+		for ( const TSharedPtr<FJsonValue>& Item : Array )
+			Copy.Add( DeepCopy( Item ) );
+
+		return MakeShareable( new FJsonValueArray( Copy ) );
+	}
+
+	if ( Value->Type == EJson::Object )
+	{
+		const TSharedPtr<FJsonObject>& Object = Value->AsObject();
+		TSharedPtr<FJsonObject> Copy = MakeShareable( new FJsonObject() );
+		if ( Object.IsValid() )
+		{
+			Copy->Values.Reserve( Object->Values.Num() );
+			for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : Object->Values )
+				Copy->Values.Add( Temp.Key, DeepCopy( Temp.Value ) );
+		}
+
+		return MakeShareable( new FJsonValueObject( Copy ) );
+	}
+
+	// scalars are never changed in place
+	return Value;
+}
+
+void FJsonLibraryPatch::Diff( const TSharedPtr<FJsonValue>& From, const TSharedPtr<FJsonValue>& To, FString& Path, TArray<TSharedPtr<FJsonValue>>& Patch )
+{
+	if ( From == To )
+		return;
+
+	const int32 Length = Path.Len();
+
+	const FJsonObject* ObjectFrom = JsonLibraryPatch::GetMutableObject( From );
+	const FJsonObject* ObjectTo = JsonLibraryPatch::GetMutableObject( To );
+	if ( ObjectFrom && ObjectTo )
+	{
+		for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : ObjectFrom->Values )
+		{
+			AppendToken( Path, Temp.Key );
+
+			const TSharedPtr<FJsonValue>* Field = ObjectTo->Values.Find( Temp.Key );
+			if ( Field )
+				Diff( Temp.Value, *Field, Path, Patch );
+			else
+				Patch.Add( JsonLibraryPatch::MakeOperation( TEXT( "remove" ), Path, TSharedPtr<FJsonValue>() ) );
+
+			Path.LeftInline( Length, false );
+		}
+
+		for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : ObjectTo->Values )
+		{
+			if ( ObjectFrom->Values.Contains( Temp.Key ) )
+				continue;
+
+			AppendToken( Path, Temp.Key );
+			Patch.Add( JsonLibraryPatch::MakeOperation( TEXT( "add" ), Path, Temp.Value ) );
+			Path.LeftInline( Length, false );
+		}
+
+		return;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* ArrayFrom = JsonLibraryPatch::GetMutableArray( From );
+	const TArray<TSharedPtr<FJsonValue>>* ArrayTo = JsonLibraryPatch::GetMutableArray( To );
+	if ( ArrayFrom && ArrayTo )
+	{
+		// element by element; insertions in the middle show up as replacements
+		const int32 Common = FMath::Min( ArrayFrom->Num(), ArrayTo->Num() );
+		for ( int32 i = 0; i < Common; i++ )
+		{
+			AppendToken( Path, FString::FromInt( i ) );
+			Diff( ( *ArrayFrom )[ i ], ( *ArrayTo )[ i ], Path, Patch );
+			Path.LeftInline( Length, false );
+		}
+
+		for ( int32 i = Common; i < ArrayTo->Num(); i++ )
+		{
+			AppendToken( Path, FString::FromInt( i ) );
+			Patch.Add( JsonLibraryPatch::MakeOperation( TEXT( "add" ), Path, ( *ArrayTo )[ i ] ) );
+			Path.LeftInline( Length, false );
+		}
+
+		for ( int32 i = ArrayFrom->Num() - 1; i >= Common; i-- )
+		{
+			AppendToken( Path, FString::FromInt( i ) );
+			Patch.Add( JsonLibraryPatch::MakeOperation( TEXT( "remove" ), Path, TSharedPtr<FJsonValue>() ) );
+			Path.LeftInline( Length, false );
+		}
+
+		return;
+	}
+
+	if ( !DeepEquals( From, To ) )
+		Patch.Add( JsonLibraryPatch::MakeOperation( TEXT( "replace" ), Path, IsNull( To ) ? TSharedPtr<FJsonValue>( MakeShareable( new FJsonValueNull() ) ) : To ) );
+}
+
+bool FJsonLibraryPatch::Apply( TSharedPtr<FJsonValue>& Root, const TSharedPtr<FJsonValue>& Operation )
+{
+	const FJsonObject* Object = JsonLibraryPatch::GetMutableObject( Operation );
+	if ( !Object )
+		return false;
+
+	FString Op, Path;
+	if ( !Object->TryGetStringField( TEXT( "op" ), Op ) || !Object->TryGetStringField( TEXT( "path" ), Path ) )
+		return false;
+
+	TArray<FString> Tokens;
+	if ( !ParsePointer( Path, Tokens ) )
+		return false;
+
+	if ( Op == TEXT( "add" ) || Op == TEXT( "replace" ) || Op == TEXT( "test" ) )
+	{
+		const TSharedPtr<FJsonValue>* Value = Object->Values.Find( TEXT( "value" ) );
+		if ( !Value || !Value->IsValid() )
+			return false;
+
+		if ( Op == TEXT( "test" ) )
+		{
+			const TSharedPtr<FJsonValue> Current = JsonLibraryPatch::Resolve( Root, Tokens, Tokens.Num() );
+			return Current.IsValid() && DeepEquals( Current, *Value );
+		}
+
+		// the document must not share containers with the patch
+		if ( Op == TEXT( "add" ) )
+			return JsonLibraryPatch::Add( Root, Tokens, DeepCopy( *Value ) );
+
+		return JsonLibraryPatch::Replace( Root, Tokens, DeepCopy( *Value ) );
+	}
+
+	if ( Op == TEXT( "remove" ) )
+		return JsonLibraryPatch::Remove( Root, Tokens );
+
+	if ( Op == TEXT( "move" ) || Op == TEXT( "copy" ) )
+	{
+		FString From;
+		TArray<FString> FromTokens;
+		if ( !Object->TryGetStringField( TEXT( "from" ), From ) || !ParsePointer( From, FromTokens ) )
+			return false;
+
+		const TSharedPtr<FJsonValue> Value = JsonLibraryPatch::Resolve( Root, FromTokens, FromTokens.Num() );
+		if ( !Value.IsValid() )
+			return false;
+
+		if ( Op == TEXT( "copy" ) )
+			return JsonLibraryPatch::Add( Root, Tokens, DeepCopy( Value ) );
+
+		if ( Path == From )
+			return true;
+
+		// a value can't be moved into one of its children
+		if ( Path.StartsWith( From + TEXT( "/" ), ESearchCase::CaseSensitive ) )
+			return false;
+
+		return JsonLibraryPatch::Remove( Root, FromTokens ) && JsonLibraryPatch::Add( Root, Tokens, Value );
+	}
+
+	return false;
+}
+
+TSharedPtr<FJsonValue> FJsonLibraryPatch::MergeDiff( const TSharedPtr<FJsonValue>& From, const TSharedPtr<FJsonValue>& To )
+{
+	if ( From == To )
+		return TSharedPtr<FJsonValue>();
+
+	const FJsonObject* ObjectFrom = JsonLibraryPatch::GetMutableObject( From );
+	const FJsonObject* ObjectTo = JsonLibraryPatch::GetMutableObject( To );
+	if ( !ObjectFrom || !ObjectTo )
+	{
+		if ( DeepEquals( From, To ) )
+			return TSharedPtr<FJsonValue>();
+
+		return IsNull( To ) ? TSharedPtr<FJsonValue>( MakeShareable( new FJsonValueNull() ) ) : To;
+	}
+
+	TSharedPtr<FJsonObject> Patch = MakeShareable( new FJsonObject() );
+	for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : ObjectFrom->Values )
+	{
+		if ( !ObjectTo->Values.Contains( Temp.Key ) )
+			Patch->SetField( Temp.Key, MakeShareable( new FJsonValueNull() ) );
+	}
+
+	for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : ObjectTo->Values )
+	{
+		const TSharedPtr<FJsonValue>* Field = ObjectFrom->Values.Find( Temp.Key );
+		if ( !Field )
+		{
+			Patch->SetField( Temp.Key, Temp.Value );
+			continue;
+		}
+
+		const TSharedPtr<FJsonValue> Value = MergeDiff( *Field, Temp.Value );
+		if ( Value.IsValid() )
+			Patch->SetField( Temp.Key, Value );
+	}
+
+	if ( Patch->Values.Num() == 0 )
+		return TSharedPtr<FJsonValue>();
+
+	return MakeShareable( new FJsonValueObject( Patch ) );
+}
+
+TSharedPtr<FJsonValue> FJsonLibraryPatch::MergeApply( const TSharedPtr<FJsonValue>& Target, const TSharedPtr<FJsonValue>& Patch )
+{
+	const FJsonObject* ObjectPatch = JsonLibraryPatch::GetMutableObject( Patch );
+	if ( !ObjectPatch )
+		return DeepCopy( Patch );
+
+	TSharedPtr<FJsonValue> Result = Target;
+	FJsonObject* Object = JsonLibraryPatch::GetMutableObject( Result );
+	if ( !Object )
+	{
+		Result = MakeShareable( new FJsonValueObject( MakeShareable( new FJsonObject() ) ) );
+		Object = JsonLibraryPatch::GetMutableObject( Result );
+	}
+
+	for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : ObjectPatch->Values )
+	{
+		if ( IsNull( Temp.Value ) )
+		{
+			Object->Values.Remove( Temp.Key );
+			continue;
+		}
+
+		TSharedPtr<FJsonValue>* Field = Object->Values.Find( Temp.Key );
+		if ( Field )
+			*Field = MergeApply( *Field, Temp.Value );
+		else
+			Object->SetField( Temp.Key, MergeApply( TSharedPtr<FJsonValue>(), Temp.Value ) );
+	}
+
+	return Result;
+}
+
+void FJsonLibraryPatch::AppendToken( FString& Pointer, const FString& Token )
+{
+	Pointer.AppendChar( TCHAR( '/' ) );
+
+	const int32 Length = Token.Len();
+	for ( int32 i = 0; i < Length; i++ )
+	{
+		const TCHAR Char = Token[ i ];
+		if ( Char == TCHAR( '~' ) )
+			Pointer.Append( TEXT( "~0" ) );
+		else if ( Char == TCHAR( '/' ) )
+			Pointer.Append( TEXT( "~1" ) );
+		else
+			Pointer.AppendChar( Char );
+	}
+}
+
+bool FJsonLibraryPatch::ParsePointer( const FString& Pointer, TArray<FString>& Tokens )
+{
+	Tokens.Reset();
+	if ( Pointer.IsEmpty() )
+		return true;
+	if ( Pointer[ 0 ] != TCHAR( '/' ) )
+		return false;
+
+	FString Token;
+	const int32 Length = Pointer.Len();
+	for ( int32 i = 1; i <= Length; i++ )
+	{
+		if ( i == Length || Pointer[ i ] == TCHAR( '/' ) )
+		{
+			Tokens.Add( Token );
+			Token.Reset();
+			continue;
+		}
+
+		const TCHAR Char = Pointer[ i ];
+		if ( Char != TCHAR( '~' ) )
+		{
+			Token.AppendChar( Char );
+			continue;
+		}
+
+		if ( i + 1 >= Length )
+			return false;
+
+		const TCHAR Escape = Pointer[ ++i ];
+		if ( Escape == TCHAR( '0' ) )
+			Token.AppendChar( TCHAR( '~' ) );
+		else if ( Escape == TCHAR( '1' ) )
+			Token.AppendChar( TCHAR( '/' ) );
+		else
+			return false;
+	}
+
+	return true;
+}
+
+bool FJsonLibraryPatch::IsNull( const TSharedPtr<FJsonValue>& Value )
+{
+	return !Value.IsValid() || Value->Type == EJson::Null || Value->Type == EJson::None;
+}
@@ -0,0 +1,32 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+
+// JSON Patch (RFC 6902) and JSON Merge Patch (RFC 7396) on raw JSON values.
+struct FJsonLibraryPatch
+{
+	// Check if two JSON values have the same contents.
+	static bool DeepEquals( const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B );
+	// Copy a JSON value and everything it contains.
+	static TSharedPtr<FJsonValue> DeepCopy( const TSharedPtr<FJsonValue>& Value );
+
+	// Append the operations that turn one value into another; unchanged shared values are skipped without a walk.
+	static void Diff( const TSharedPtr<FJsonValue>& From, const TSharedPtr<FJsonValue>& To, FString& Path, TArray<TSharedPtr<FJsonValue>>& Patch );
+	// Apply a single patch operation in place.
+	static bool Apply( TSharedPtr<FJsonValue>& Root, const TSharedPtr<FJsonValue>& Operation );
+
+	// Create the merge patch that turns one value into another, or null if they are equal.
+	static TSharedPtr<FJsonValue> MergeDiff( const TSharedPtr<FJsonValue>& From, const TSharedPtr<FJsonValue>& To );
+	// Apply a merge patch in place and return the result.
+	static TSharedPtr<FJsonValue> MergeApply( const TSharedPtr<FJsonValue>& Target, const TSharedPtr<FJsonValue>& Patch );
+
+	// Append an escaped reference token to a JSON pointer.
+	static void AppendToken( FString& Pointer, const FString& Token );
+	// Split a JSON pointer into unescaped reference tokens.
+	static bool ParsePointer( const FString& Pointer, TArray<FString>& Tokens );
+
+	// Check if a JSON value is missing or null.
+	static bool IsNull( const TSharedPtr<FJsonValue>& Value );
+};
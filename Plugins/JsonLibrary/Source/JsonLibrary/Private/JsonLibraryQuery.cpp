@@ -0,0 +1,410 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibraryQuery.h"
+#include "JsonLibraryPatch.h"
+
+struct FJsonLibraryQueryStep
+{
+	// Member name, with its hash precomputed for the object lookup.
+	FString Key;
+	uint32 KeyHash;
+	// Array index; negative indices count from the end.
+	int32 Index;
+
+	bool bKey;
+	bool bIndex;
+	bool bWildcard;
+
+	FJsonLibraryQueryStep()
+	{
+		KeyHash = 0;
+		Index = 0;
+
+		bKey = false;
+		bIndex = false;
+		bWildcard = false;
+	}
+
+	void SetKey( const FString& InKey )
+	{
+		Key = InKey;
+		KeyHash = GetTypeHash( Key );
+		bKey = true;
+	}
+
+	void SetIndex( int32 InIndex )
+	{
+		Index = InIndex;
+		bIndex = true;
+	}
+
+	const TSharedPtr<FJsonValue>* Resolve( const TSharedPtr<FJsonValue>& Value ) const
+	{
+		if ( !Value.IsValid() )
+			return nullptr;
+
+		if ( bKey && Value->Type == EJson::Object )
+		{
+			const TSharedPtr<FJsonObject>& Object = Value->AsObject();
+			if ( Object.IsValid() )
+				return Object->Values.FindByHash( KeyHash, Key );
+		}
+		else if ( bIndex && Value->Type == EJson::Array )
+		{
+			const TArray<TSharedPtr<FJsonValue>>& Array = Value->AsArray();
+
+			const int32 Item = Index < 0 ? Array.Num() + Index : Index;
+			if ( Array.IsValidIndex( Item ) )
+				return &Array[ Item ];
+		}
+
+		return nullptr;
+	}
+};
+
+FJsonLibraryQuery::FJsonLibraryQuery()
+{
+	bMultiple = false;
+}
+
+FJsonLibraryQuery FJsonLibraryQuery::Compile( const FString& Query )
+{
+	FJsonLibraryQuery Result;
+
+	TArray<FJsonLibraryQueryStep> QuerySteps;
+	const bool bPath = Query.StartsWith( TEXT( "$" ), ESearchCase::CaseSensitive );
+	if ( bPath ? !Result.TryCompilePath( Query, QuerySteps ) : !Result.TryCompilePointer( Query, QuerySteps ) )
+		return Result;
+
+	for ( const FJsonLibraryQueryStep& Step : QuerySteps )
+		Result.bMultiple |= Step.bWildcard;
+
+	Result.Text = Query;
+	Result.Steps = MakeShareable( new TArray<FJsonLibraryQueryStep>( MoveTemp( QuerySteps ) ) );
+
+	return Result;
+}
+
+bool FJsonLibraryQuery::IsValid() const
+{
+	return Steps.IsValid();
+}
+
+bool FJsonLibraryQuery::IsMultiple() const
+{
+	return bMultiple;
+}
+
+FString FJsonLibraryQuery::GetText() const
+{
+	return Text;
+}
+
+FJsonLibraryValue FJsonLibraryQuery::Find( const FJsonLibraryValue& Value ) const
+{
+	if ( !Steps.IsValid() )
+		return FJsonLibraryValue( TSharedPtr<FJsonValue>() );
+
+	const TSharedPtr<FJsonValue>* Found = FindFirst( Value.JsonValue );
+	if ( !Found )
+		return FJsonLibraryValue( TSharedPtr<FJsonValue>() );
+
+	return FJsonLibraryValue( *Found );
+}
+
+TArray<FJsonLibraryValue> FJsonLibraryQuery::FindAll( const FJsonLibraryValue& Value ) const
+{
+	TArray<FJsonLibraryValue> Values;
+	if ( Steps.IsValid() )
+		FindAll( Value.JsonValue, 0, Values );
+
+	return Values;
+}
+
+TArray<FJsonLibraryValue> FJsonLibraryQuery::ExtractArray( const FJsonLibraryList& List ) const
+{
+	return Extract<FJsonLibraryValue>( List, []( const TSharedPtr<FJsonValue>* Found )
+	{
+		return FJsonLibraryValue( Found ? *Found : TSharedPtr<FJsonValue>() );
+	} );
+}
+
+TArray<bool> FJsonLibraryQuery::ExtractBooleanArray( const FJsonLibraryList& List ) const
+{
+	return Extract<bool>( List, []( const TSharedPtr<FJsonValue>* Found )
+	{
+		if ( !Found || !Found->IsValid() )
+			return false;
+		if ( ( *Found )->Type == EJson::Boolean )
+			return ( *Found )->AsBool();
+
+		return FJsonLibraryValue( *Found ).GetBoolean();
+	} );
+}
+
+TArray<float> FJsonLibraryQuery::ExtractFloatArray( const FJsonLibraryList& List ) const
+{
+	return Extract<float>( List, []( const TSharedPtr<FJsonValue>* Found )
+	{
+		if ( !Found || !Found->IsValid() )
+			return 0.0f;
+		if ( ( *Found )->Type == EJson::Number )
+			return (float)( *Found )->AsNumber();
+
+		return FJsonLibraryValue( *Found ).GetFloat();
+	} );
+}
+
+TArray<int32> FJsonLibraryQuery::ExtractIntegerArray( const FJsonLibraryList& List ) const
+{
+	return Extract<int32>( List, []( const TSharedPtr<FJsonValue>* Found )
+	{
+		if ( !Found || !Found->IsValid() )
+			return 0;
+		if ( ( *Found )->Type == EJson::Number )
+			return (int32)( *Found )->AsNumber();
+
+		return FJsonLibraryValue( *Found ).GetInteger();
+	} );
+}
+
+TArray<double> FJsonLibraryQuery::ExtractNumberArray( const FJsonLibraryList& List ) const
+{
+	return Extract<double>( List, []( const TSharedPtr<FJsonValue>* Found )
+	{
+		if ( !Found || !Found->IsValid() )
+			return 0.0;
+		if ( ( *Found )->Type == EJson::Number )
+			return ( *Found )->AsNumber();
+
+		return FJsonLibraryValue( *Found ).GetNumber();
+	} );
+}
+
+TArray<FString> FJsonLibraryQuery::ExtractStringArray( const FJsonLibraryList& List ) const
+{
+	return Extract<FString>( List, []( const TSharedPtr<FJsonValue>* Found )
+	{
+		if ( !Found || !Found->IsValid() )
+			return FString();
+		if ( ( *Found )->Type == EJson::String )
+			return ( *Found )->AsString();
+
+		return FJsonLibraryValue( *Found ).GetString();
+	} );
+}
+
+bool FJsonLibraryQuery::TryCompilePointer( const FString& Pointer, TArray<FJsonLibraryQueryStep>& OutSteps ) const
+{
+	TArray<FString> Tokens;
+	if ( !FJsonLibraryPatch::ParsePointer( Pointer, Tokens ) )
+		return false;
+
+	OutSteps.Reset( Tokens.Num() );
+	for ( const FString& Token : Tokens )
+	{
+		FJsonLibraryQueryStep& Step = OutSteps.AddDefaulted_GetRef();
+		Step.SetKey( Token );
+
+		// Array indices are digits without leading zeros.
+		if ( Token.IsEmpty() || Token.Len() > 9 || ( Token.Len() > 1 && Token[ 0 ] == TCHAR( '0' ) ) )
+			continue;
+
+		bool bDigits = true;
+		for ( const TCHAR Char : Token )
+			bDigits &= FChar::IsDigit( Char );
+
+		if ( bDigits )
+			Step.SetIndex( FCString::Atoi( *Token ) );
+	}
+
+	return true;
+}
+
+bool FJsonLibraryQuery::TryCompilePath( const FString& Path, TArray<FJsonLibraryQueryStep>& OutSteps ) const
+{
+	OutSteps.Reset();
+
+	const int32 Length = Path.Len();
+	int32 i = 1;
+
+	while ( i < Length )
+	{
+		const TCHAR Char = Path[ i ];
+		if ( Char == TCHAR( '.' ) )
+		{
+			i++;
+			if ( i >= Length )
+				return false;
+
+			FJsonLibraryQueryStep& Step = OutSteps.AddDefaulted_GetRef();
+			if ( Path[ i ] == TCHAR( '*' ) )
+			{
+				Step.bWildcard = true;
+				i++;
+				continue;
+			}
+
+			// Recursive descent is not supported.
+			if ( Path[ i ] == TCHAR( '.' ) || Path[ i ] == TCHAR( '[' ) )
+				return false;
+
+			const int32 Start = i;
+			while ( i < Length && Path[ i ] != TCHAR( '.' ) && Path[ i ] != TCHAR( '[' ) )
+				i++;
+
+			Step.SetKey( Path.Mid( Start, i - Start ) );
+		}
+		else if ( Char == TCHAR( '[' ) )
+		{
+			i++;
+			while ( i < Length && FChar::IsWhitespace( Path[ i ] ) )
+				i++;
+			if ( i >= Length )
+				return false;
+
+			FJsonLibraryQueryStep& Step = OutSteps.AddDefaulted_GetRef();
+			const TCHAR Next = Path[ i ];
+			if ( Next == TCHAR( '*' ) )
+			{
+				Step.bWildcard = true;
+				i++;
+			}
+			else if ( Next == TCHAR( '\'' ) || Next == TCHAR( '"' ) )
+			{
+				FString Key;
+				for ( i++; i < Length && Path[ i ] != Next; i++ )
+				{
+					if ( Path[ i ] == TCHAR( '\\' ) && i + 1 < Length )
+						i++;
+
+					Key.AppendChar( Path[ i ] );
+				}
+
+				if ( i >= Length )
+					return false;
+
+				Step.SetKey( Key );
+				i++;
+			}
+			else
+			{
+				const int32 Start = i;
+				if ( Path[ i ] == TCHAR( '-' ) )
+					i++;
+				while ( i < Length && FChar::IsDigit( Path[ i ] ) )
+					i++;
+
+				const FString Number = Path.Mid( Start, i - Start );
+				if ( Number.IsEmpty() || Number == TEXT( "-" ) || Number.Len() > 10 )
+					return false;
+
+				Step.SetIndex( FCString::Atoi( *Number ) );
+			}
+
+			while ( i < Length && FChar::IsWhitespace( Path[ i ] ) )
+				i++;
+			if ( i >= Length || Path[ i ] != TCHAR( ']' ) )
+				return false;
+
+			i++;
+		}
+		else
+			return false;
+	}
+
+	return true;
+}
+
+const TSharedPtr<FJsonValue>* FJsonLibraryQuery::FindFirst( const TSharedPtr<FJsonValue>& Value, int32 Step /*= 0*/ ) const
+{
+	const TArray<FJsonLibraryQueryStep>& QuerySteps = *Steps;
+
+	const TSharedPtr<FJsonValue>* Current = &Value;
+	for ( int32 i = Step; i < QuerySteps.Num(); i++ )
+	{
+		if ( !QuerySteps[ i ].bWildcard )
+		{
+			Current = QuerySteps[ i ].Resolve( *Current );
+			if ( !Current )
+				return nullptr;
+
+			continue;
+		}
+
+		if ( !Current->IsValid() )
+			return nullptr;
+
+		if ( ( *Current )->Type == EJson::Array )
+		{
+			for ( const TSharedPtr<FJsonValue>& Item : ( *Current )->AsArray() )
+			{
+				if ( const TSharedPtr<FJsonValue>* Found = FindFirst( Item, i + 1 ) )
+					return Found;
+			}
+		}
+		else if ( ( *Current )->Type == EJson::Object && ( *Current )->AsObject().IsValid() )
+		{
+			for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : ( *Current )->AsObject()->Values )
+			{
+				if ( const TSharedPtr<FJsonValue>* Found = FindFirst( Temp.Value, i + 1 ) )
+					return Found;
+			}
+		}
+
+		return nullptr;
+	}
+
+	return Current;
+}
+
+void FJsonLibraryQuery::FindAll( const TSharedPtr<FJsonValue>& Value, int32 Step, TArray<FJsonLibraryValue>& Values ) const
+{
+	const TArray<FJsonLibraryQueryStep>& QuerySteps = *Steps;
+
+	const TSharedPtr<FJsonValue>* Current = &Value;
+	for ( int32 i = Step; i < QuerySteps.Num(); i++ )
+	{
+		if ( !QuerySteps[ i ].bWildcard )
+		{
+			Current = QuerySteps[ i ].Resolve( *Current );
+			if ( !Current )
+				return;
+
+			continue;
+		}
+
+		if ( !Current->IsValid() )
+			return;
+
+		if ( ( *Current )->Type == EJson::Array )
+		{
+			for ( const TSharedPtr<FJsonValue>& Item : ( *Current )->AsArray() )
+				FindAll( Item, i + 1, Values );
+		}
+		else if ( ( *Current )->Type == EJson::Object && ( *Current )->AsObject().IsValid() )
+		{
+			for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : ( *Current )->AsObject()->Values )
+				FindAll( Temp.Value, i + 1, Values );
+		}
+
+		return;
+	}
+
+	Values.Add( FJsonLibraryValue( *Current ) );
+}
+
+template<typename ItemType, typename ConvertType>
+TArray<ItemType> FJsonLibraryQuery::Extract( const FJsonLibraryList& List, ConvertType Convert ) const
+{
+	TArray<ItemType> Array;
+
+	const TArray<TSharedPtr<FJsonValue>>* Json = List.GetJsonArray();
+	if ( !Json )
+		return Array;
+
+	Array.Reserve( Json->Num() );
+	for ( const TSharedPtr<FJsonValue>& Item : *Json )
+		Array.Add( Convert( Steps.IsValid() ? FindFirst( Item ) : nullptr ) );
+
+	return Array;
+}
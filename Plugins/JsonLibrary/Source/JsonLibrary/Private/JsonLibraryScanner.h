@@ -0,0 +1,320 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+#include "JsonLibraryNumberCodec.h"
+
+// Scans JSON text by offset; values are only built on request.
+struct FJsonLibraryScanner
+{
+	// Deepest nesting accepted by Skip.
+	static const int32 MaxDepth = 1024;
+
+	const TCHAR* Text;
+	int32 Length;
+
+	FJsonLibraryScanner( const FString& InText )
+	{
+		Text = *InText;
+		Length = InText.Len();
+	}
+
+	FJsonLibraryScanner( const TCHAR* InText, int32 InLength )
+	{
+		Text = InText;
+		Length = InLength;
+	}
+
+	void SkipWhitespace( int32& Pos ) const
+	{
+		while ( Pos < Length && ( Text[ Pos ] == TCHAR( ' ' ) || Text[ Pos ] == TCHAR( '\n' ) || Text[ Pos ] == TCHAR( '\r' ) || Text[ Pos ] == TCHAR( '\t' ) ) )
+			Pos++;
+	}
+
+	bool SkipLiteral( int32& Pos, const TCHAR* Literal ) const
+	{
+		for ( ; *Literal; Literal++, Pos++ )
+		{
+			if ( Pos >= Length || Text[ Pos ] != *Literal )
+				return false;
+		}
+
+		return true;
+	}
+
+	EJson GetType( int32 Pos ) const
+	{
+		if ( Pos >= Length )
+			return EJson::None;
+
+		switch ( Text[ Pos ] )
+		{
+			case TCHAR( '{' ): return EJson::Object;
+			case TCHAR( '[' ): return EJson::Array;
+			case TCHAR( '"' ): return EJson::String;
+			case TCHAR( 't' ):
+			case TCHAR( 'f' ): return EJson::Boolean;
+			case TCHAR( 'n' ): return EJson::Null;
+		}
+
+		return EJson::Number;
+	}
+
+	// Read a string starting at its opening quote; the value is only unescaped when requested.
+	bool ReadString( int32& Pos, FString* Value ) const
+	{
+		if ( Pos >= Length || Text[ Pos ] != TCHAR( '"' ) )
+			return false;
+
+		int32 Run = ++Pos;
+		while ( Pos < Length )
+		{
+			const TCHAR Char = Text[ Pos ];
+			if ( Char == TCHAR( '"' ) )
+			{
+				if ( Value )
+					Value->AppendChars( Text + Run, Pos - Run );
+
+				Pos++;
+				return true;
+			}
+
+			if ( Char != TCHAR( '\\' ) )
+			{
+				Pos++;
+				continue;
+			}
+
+			if ( Value )
+				Value->AppendChars( Text + Run, Pos - Run );
+			if ( ++Pos >= Length )
+				return false;
+
+			TCHAR Escape = Text[ Pos++ ];
+			switch ( Escape )
+			{
+				case TCHAR( '"' ):
+				case TCHAR( '\\' ):
+				case TCHAR( '/' ): break;
+				case TCHAR( 'b' ): Escape = TCHAR( '\b' ); break;
+				case TCHAR( 'f' ): Escape = TCHAR( '\f' ); break;
+				case TCHAR( 'n' ): Escape = TCHAR( '\n' ); break;
+				case TCHAR( 'r' ): Escape = TCHAR( '\r' ); break;
+				case TCHAR( 't' ): Escape = TCHAR( '\t' ); break;
+				case TCHAR( 'u' ):
+				{
+					if ( Length - Pos < 4 )
+						return false;
+
+					uint32 CodeUnit = 0;
+					for ( int32 i = 0; i < 4; i++ )
+					{
+						const TCHAR Hex = Text[ Pos++ ];
+						CodeUnit <<= 4;
+
+						if ( Hex >= TCHAR( '0' ) && Hex <= TCHAR( '9' ) )
+							CodeUnit |= Hex - TCHAR( '0' );
+						else if ( Hex >= TCHAR( 'a' ) && Hex <= TCHAR( 'f' ) )
+							CodeUnit |= Hex - TCHAR( 'a' ) + 10;
+						else if ( Hex >= TCHAR( 'A' ) && Hex <= TCHAR( 'F' ) )
+							CodeUnit |= Hex - TCHAR( 'A' ) + 10;
+						else
+							return false;
+					}
+
+					// surrogate pairs arrive as two escapes, which is what a UTF-16 TCHAR wants
+					Escape = (TCHAR)CodeUnit;
+					break;
+				}
+				default:
+					return false;
+			}
+
+			if ( Value )
+				Value->AppendChar( Escape );
+
+			Run = Pos;
+		}
+
+		return false;
+	}
+
+	bool ReadNumber( int32& Pos, double& Value ) const
+	{
+		const TCHAR* Cursor = Text + Pos;
+		if ( !FJsonLibraryNumberCodec::ReadDouble( Cursor, Text + Length, Value ) )
+			return false;
+
+		Pos = (int32)( Cursor - Text );
+		return true;
+	}
+
+	// Validate the value at a position and move past it.
+	bool Skip( int32& Pos, int32 Depth ) const
+	{
+		if ( Depth > MaxDepth )
+			return false;
+
+		switch ( GetType( Pos ) )
+		{
+			case EJson::Object:
+			{
+				Pos++;
+				SkipWhitespace( Pos );
+				if ( Pos < Length && Text[ Pos ] == TCHAR( '}' ) )
+				{
+					Pos++;
+					return true;
+				}
+
+				while ( true )
+				{
+					if ( !ReadString( Pos, nullptr ) )
+						return false;
+
+					SkipWhitespace( Pos );
+					if ( Pos >= Length || Text[ Pos++ ] != TCHAR( ':' ) )
+						return false;
+
+					SkipWhitespace( Pos );
+					if ( !Skip( Pos, Depth + 1 ) )
+						return false;
+
+					SkipWhitespace( Pos );
+					if ( Pos >= Length )
+						return false;
+
+					const TCHAR Char = Text[ Pos++ ];
+					if ( Char == TCHAR( '}' ) )
+						return true;
+					if ( Char != TCHAR( ',' ) )
+						return false;
+
+					SkipWhitespace( Pos );
+				}
+			}
+			case EJson::Array:
+			{
+				Pos++;
+				SkipWhitespace( Pos );
+				if ( Pos < Length && Text[ Pos ] == TCHAR( ']' ) )
+				{
+					Pos++;
+					return true;
+				}
+
+				while ( true )
+				{
+					if ( !Skip( Pos, Depth + 1 ) )
+						return false;
+
+					SkipWhitespace( Pos );
+					if ( Pos >= Length )
+						return false;
+
+					const TCHAR Char = Text[ Pos++ ];
+					if ( Char == TCHAR( ']' ) )
+						return true;
+					if ( Char != TCHAR( ',' ) )
+						return false;
+
+					SkipWhitespace( Pos );
+				}
+			}
+			case EJson::String:
+				return ReadString( Pos, nullptr );
+			case EJson::Boolean:
+				return Text[ Pos ] == TCHAR( 't' ) ? SkipLiteral( Pos, TEXT( "true" ) ) : SkipLiteral( Pos, TEXT( "false" ) );
+			case EJson::Null:
+				return SkipLiteral( Pos, TEXT( "null" ) );
+			case EJson::Number:
+			{
+				double Value;
+				return ReadNumber( Pos, Value );
+			}
+		}
+
+		return false;
+	}
+
+	// Build the value at a position, which must already be validated.
+	TSharedPtr<FJsonValue> Build( int32& Pos ) const
+	{
+		switch ( GetType( Pos ) )
+		{
+			case EJson::Object:
+			{
+				TSharedPtr<FJsonObject> Object = MakeShareable( new FJsonObject() );
+
+				Pos++;
+				SkipWhitespace( Pos );
+				while ( Pos < Length && Text[ Pos ] != TCHAR( '}' ) )
+				{
+					FString Key;
+					ReadString( Pos, &Key );
+
+					SkipWhitespace( Pos );
+					Pos++;
+					SkipWhitespace( Pos );
+
+					Object->SetField( Key, Build( Pos ) );
+
+					SkipWhitespace( Pos );
+					if ( Text[ Pos ] == TCHAR( ',' ) )
+					{
+						Pos++;
+						SkipWhitespace( Pos );
+					}
+				}
+
+				Pos++;
+				return MakeShareable( new FJsonValueObject( Object ) );
+			}
+			case EJson::Array:
+			{
+				TArray<TSharedPtr<FJsonValue>> Array;
+
+				Pos++;
+				SkipWhitespace( Pos );
+				while ( Pos < Length && Text[ Pos ] != TCHAR( ']' ) )
+				{
+					Array.Add( Build( Pos ) );
+
+					SkipWhitespace( Pos );
+					if ( Text[ Pos ] == TCHAR( ',' ) )
+					{
+						Pos++;
+						SkipWhitespace( Pos );
+					}
+				}
+
+				Pos++;
+				return MakeShareable( new FJsonValueArray( Array ) );
+			}
+			case EJson::String:
+			{
+				FString Value;
+				ReadString( Pos, &Value );
+				return MakeShareable( new FJsonValueString( Value ) );
+			}
+			case EJson::Boolean:
+			{
+				const bool bValue = Text[ Pos ] == TCHAR( 't' );
+				Pos += bValue ? 4 : 5;
+				return MakeShareable( new FJsonValueBoolean( bValue ) );
+			}
+			case EJson::Null:
+				Pos += 4;
+				return MakeShareable( new FJsonValueNull() );
+			case EJson::Number:
+			{
+				double Value = 0.0;
+				ReadNumber( Pos, Value );
+				return MakeShareable( new FJsonValueNumber( Value ) );
+			}
+		}
+
+		return TSharedPtr<FJsonValue>();
+	}
+};
@@ -0,0 +1,803 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibrarySchema.h"
+#include "JsonLibraryConverter.h"
+#include "JsonLibraryScanner.h"
+
+namespace JsonLibrarySchema
+{
+	enum : uint8
+	{
+		TypeNull    = 1 << 0,
+		TypeBoolean = 1 << 1,
+		TypeInteger = 1 << 2,
+		TypeNumber  = 1 << 3,
+		TypeString  = 1 << 4,
+		TypeObject  = 1 << 5,
+		TypeArray   = 1 << 6,
+		TypeAny     = 0x7F,
+	};
+
+	// Node indices that stand in for the "true" and "false" schemas.
+	const int32 AnyNode = -2;
+	const int32 NoNode = -3;
+	// A required key without its own schema, checked against additionalProperties.
+	const int32 AdditionalNode = -4;
+
+	bool Fail( FString* Error, const FString& Message )
+	{
+		if ( Error )
+			*Error = TEXT( ": " ) + Message;
+
+		return false;
+	}
+
+	// Add a key or index to the front of the path of an error as it unwinds.
+	bool Prefix( FString* Error, const FString& Token )
+	{
+		if ( Error )
+			*Error = TEXT( "/" ) + Token.Replace( TEXT( "~" ), TEXT( "~0" ) ).Replace( TEXT( "/" ), TEXT( "~1" ) ) + *Error;
+
+		return false;
+	}
+
+	void Finish( FString* Error )
+	{
+		if ( Error && Error->StartsWith( TEXT( ": " ) ) )
+			Error->RemoveAt( 0, 2 );
+	}
+
+	uint8 GetTypeFlag( const FString& Name )
+	{
+		if ( Name == TEXT( "null" ) )
+			return TypeNull;
+		if ( Name == TEXT( "boolean" ) )
+			return TypeBoolean;
+		if ( Name == TEXT( "integer" ) )
+			return TypeInteger;
+		if ( Name == TEXT( "number" ) )
+			return TypeNumber;
+		if ( Name == TEXT( "string" ) )
+			return TypeString;
+		if ( Name == TEXT( "object" ) )
+			return TypeObject;
+		if ( Name == TEXT( "array" ) )
+			return TypeArray;
+
+		return 0;
+	}
+
+	FString DescribeTypes( uint8 Types )
+	{
+		static const TCHAR* Names[] = { TEXT( "null" ), TEXT( "boolean" ), TEXT( "integer" ), TEXT( "number" ), TEXT( "string" ), TEXT( "object" ), TEXT( "array" ) };
+
+		FString Description;
+		for ( int32 i = 0; i < UE_ARRAY_COUNT( Names ); i++ )
+		{
+			if ( !( Types & ( 1 << i ) ) )
+				continue;
+
+			if ( !Description.IsEmpty() )
+				Description += TEXT( " or " );
+			Description += Names[ i ];
+		}
+
+		return TEXT( "expected " ) + Description;
+	}
+
+	bool IsInteger( double Value )
+	{
+		return FMath::IsFinite( Value ) && FMath::FloorToDouble( Value ) == Value;
+	}
+
+	// Keywords that are compiled, and annotations that never change the result.
+	bool IsKeyword( const FString& Key )
+	{
+		static const TCHAR* Keywords[] =
+		{
+			TEXT( "type" ), TEXT( "enum" ), TEXT( "const" ),
+			TEXT( "minimum" ), TEXT( "maximum" ), TEXT( "exclusiveMinimum" ), TEXT( "exclusiveMaximum" ),
+			TEXT( "minLength" ), TEXT( "maxLength" ), TEXT( "minItems" ), TEXT( "maxItems" ),
+			TEXT( "properties" ), TEXT( "required" ), TEXT( "additionalProperties" ), TEXT( "items" ),
+			TEXT( "$schema" ), TEXT( "$id" ), TEXT( "title" ), TEXT( "description" ), TEXT( "default" ), TEXT( "examples" ),
+		};
+
+		for ( const TCHAR* Keyword : Keywords )
+		{
+			if ( Key.Equals( Keyword, ESearchCase::CaseSensitive ) )
+				return true;
+		}
+
+		return false;
+	}
+
+	bool ReadCount( const TSharedPtr<FJsonObject>& Object, const TCHAR* Key, int32& Count )
+	{
+		const TSharedPtr<FJsonValue>* Field = Object->Values.Find( Key );
+		if ( !Field )
+			return true;
+		if ( !Field->IsValid() || ( *Field )->Type != EJson::Number || ( *Field )->AsNumber() < 0.0 )
+			return false;
+
+		Count = (int32)FMath::Min<double>( ( *Field )->AsNumber(), MAX_int32 );
+		return true;
+	}
+}
+
+struct FJsonLibrarySchemaProperty
+{
+	int32 Node;
+	// Index into the required keys, or INDEX_NONE.
+	int32 Required;
+};
+
+// Property names in JSON are case-sensitive.
+struct FJsonLibrarySchemaKeyFuncs : TDefaultMapKeyFuncs<FString, FJsonLibrarySchemaProperty, false>
+{
+	static bool Matches( const FString& A, const FString& B )
+	{
+		return A.Equals( B, ESearchCase::CaseSensitive );
+	}
+
+	static uint32 GetKeyHash( const FString& Key )
+	{
+		return FCrc::StrCrc32( *Key );
+	}
+};
+
+struct FJsonLibrarySchemaNode
+{
+	uint8 Types = JsonLibrarySchema::TypeAny;
+
+	// Scalars accepted by enum or const.
+	bool bEnum = false;
+	TArray<TSharedPtr<FJsonValue>> Enum;
+
+	bool bMinimum = false;
+	bool bExclusiveMinimum = false;
+	double Minimum = 0.0;
+	bool bMaximum = false;
+	bool bExclusiveMaximum = false;
+	double Maximum = 0.0;
+
+	int32 MinLength = 0;
+	int32 MaxLength = MAX_int32;
+	int32 MinItems = 0;
+	int32 MaxItems = MAX_int32;
+
+	TMap<FString, FJsonLibrarySchemaProperty, FDefaultSetAllocator, FJsonLibrarySchemaKeyFuncs> Properties;
+	TArray<FString> Required;
+	int32 AdditionalProperties = JsonLibrarySchema::AnyNode;
+	int32 Items = JsonLibrarySchema::AnyNode;
+
+	bool CheckType( EJson Type, double Number, FString* Error ) const
+	{
+		uint8 Flag = 0;
+		switch ( Type )
+		{
+			case EJson::Null: Flag = JsonLibrarySchema::TypeNull; break;
+			case EJson::Boolean: Flag = JsonLibrarySchema::TypeBoolean; break;
+			case EJson::String: Flag = JsonLibrarySchema::TypeString; break;
+			case EJson::Object: Flag = JsonLibrarySchema::TypeObject; break;
+			case EJson::Array: Flag = JsonLibrarySchema::TypeArray; break;
+			case EJson::Number:
+				Flag = JsonLibrarySchema::TypeNumber;
+				if ( JsonLibrarySchema::IsInteger( Number ) )
+					Flag |= JsonLibrarySchema::TypeInteger;
+				break;
+		}
+
+		if ( Types & Flag )
+			return true;
+
+		return JsonLibrarySchema::Fail( Error, JsonLibrarySchema::DescribeTypes( Types ) );
+	}
+
+	bool CheckEnum( EJson Type, bool bValue, double Number, const FString& String, FString* Error ) const
+	{
+		if ( !bEnum )
+			return true;
+
+		for ( const TSharedPtr<FJsonValue>& Entry : Enum )
+		{
+			if ( Entry->Type != Type )
+				continue;
+
+			switch ( Type )
+			{
+				case EJson::Null:
+					return true;
+				case EJson::Boolean:
+					if ( Entry->AsBool() == bValue )
+						return true;
+					break;
+				case EJson::Number:
+					if ( Entry->AsNumber() == Number )
+						return true;
+					break;
+				case EJson::String:
+					if ( Entry->AsString().Equals( String, ESearchCase::CaseSensitive ) )
+						return true;
+					break;
+			}
+		}
+
+		return JsonLibrarySchema::Fail( Error, TEXT( "not one of the allowed values" ) );
+	}
+
+	bool CheckNumber( double Number, FString* Error ) const
+	{
+		if ( bMinimum && ( bExclusiveMinimum ? Number <= Minimum : Number < Minimum ) )
+			return JsonLibrarySchema::Fail( Error, FString::Printf( TEXT( "expected %s %g" ), bExclusiveMinimum ? TEXT( "more than" ) : TEXT( "at least" ), Minimum ) );
+		if ( bMaximum && ( bExclusiveMaximum ? Number >= Maximum : Number > Maximum ) )
+			return JsonLibrarySchema::Fail( Error, FString::Printf( TEXT( "expected %s %g" ), bExclusiveMaximum ? TEXT( "less than" ) : TEXT( "at most" ), Maximum ) );
+
+		return true;
+	}
+
+	bool CheckLength( int32 Length, FString* Error ) const
+	{
+		if ( Length < MinLength )
+			return JsonLibrarySchema::Fail( Error, FString::Printf( TEXT( "expected at least %d characters" ), MinLength ) );
+		if ( Length > MaxLength )
+			return JsonLibrarySchema::Fail( Error, FString::Printf( TEXT( "expected at most %d characters" ), MaxLength ) );
+
+		return true;
+	}
+
+	bool CheckItems( int32 Count, FString* Error ) const
+	{
+		if ( Count < MinItems )
+			return JsonLibrarySchema::Fail( Error, FString::Printf( TEXT( "expected at least %d items" ), MinItems ) );
+		if ( Count > MaxItems )
+			return JsonLibrarySchema::Fail( Error, FString::Printf( TEXT( "expected at most %d items" ), MaxItems ) );
+
+		return true;
+	}
+
+	bool CheckRequired( const TBitArray<>& Found, FString* Error ) const
+	{
+		for ( int32 i = 0; i < Required.Num(); i++ )
+		{
+			if ( !Found[ i ] )
+				return JsonLibrarySchema::Fail( Error, FString::Printf( TEXT( "missing required property \"%s\"" ), *Required[ i ] ) );
+		}
+
+		return true;
+	}
+
+	// Find the schema for a property value, and mark it off if it is required.
+	int32 GetProperty( const FString& Key, TBitArray<>& Found ) const
+	{
+		const FJsonLibrarySchemaProperty* Property = Properties.Find( Key );
+		if ( !Property )
+			return AdditionalProperties;
+
+		if ( Property->Required != INDEX_NONE )
+			Found[ Property->Required ] = true;
+
+		return Property->Node == JsonLibrarySchema::AdditionalNode ? AdditionalProperties : Property->Node;
+	}
+
+	bool NeedsString() const
+	{
+		return bEnum || MinLength > 0 || MaxLength < MAX_int32;
+	}
+};
+
+FJsonLibrarySchema::FJsonLibrarySchema()
+{
+}
+
+FJsonLibrarySchema FJsonLibrarySchema::Compile( const FJsonLibraryValue& Schema )
+{
+	FJsonLibrarySchema Compiled;
+	if ( !Schema.JsonValue.IsValid() )
+		return Compiled;
+
+	TSharedPtr<TArray<FJsonLibrarySchemaNode>> Nodes = MakeShareable( new TArray<FJsonLibrarySchemaNode>() );
+
+	// the root is always a real node, so "true" and "false" become an empty schema and one that allows no type
+	if ( Schema.JsonValue->Type == EJson::Boolean )
+	{
+		FJsonLibrarySchemaNode& Root = Nodes->AddDefaulted_GetRef();
+		if ( !Schema.JsonValue->AsBool() )
+			Root.Types = 0;
+	}
+	else if ( CompileNode( Schema.JsonValue, *Nodes ) != 0 )
+		return Compiled;
+
+	Compiled.Nodes = Nodes;
+	return Compiled;
+}
+
+FJsonLibrarySchema FJsonLibrarySchema::Compile( const FString& Schema )
+{
+	return Compile( FJsonLibraryValue::Parse( Schema ) );
+}
+
+int32 FJsonLibrarySchema::CompileNode( const TSharedPtr<FJsonValue>& Schema, TArray<FJsonLibrarySchemaNode>& OutNodes )
+{
+	if ( !Schema.IsValid() )
+		return INDEX_NONE;
+	if ( Schema->Type == EJson::Boolean )
+		return Schema->AsBool() ? JsonLibrarySchema::AnyNode : JsonLibrarySchema::NoNode;
+	if ( Schema->Type != EJson::Object )
+		return INDEX_NONE;
+
+	const TSharedPtr<FJsonObject> Object = Schema->AsObject();
+
+	// a keyword that is not supported would otherwise be skipped and let everything through
+	for ( const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object->Values )
+	{
+		if ( !JsonLibrarySchema::IsKeyword( Field.Key ) )
+			return INDEX_NONE;
+	}
+
+	// children are added while this node is built, so it is only moved into place at the end
+	const int32 Index = OutNodes.AddDefaulted();
+	FJsonLibrarySchemaNode Node;
+
+	if ( const TSharedPtr<FJsonValue>* Field = Object->Values.Find( TEXT( "type" ) ) )
+	{
+		TArray<TSharedPtr<FJsonValue>> Names;
+		if ( ( *Field )->Type == EJson::Array )
+			Names = ( *Field )->AsArray();
+		else
+			Names.Add( *Field );
+
+		Node.Types = 0;
+		for ( const TSharedPtr<FJsonValue>& Name : Names )
+		{
+			const uint8 Flag = Name.IsValid() && Name->Type == EJson::String ? JsonLibrarySchema::GetTypeFlag( Name->AsString() ) : 0;
+			if ( Flag == 0 )
+				return INDEX_NONE;
+
+			Node.Types |= Flag;
+		}
+	}
+
+	if ( const TSharedPtr<FJsonValue>* Field = Object->Values.Find( TEXT( "enum" ) ) )
+	{
+		if ( ( *Field )->Type != EJson::Array )
+			return INDEX_NONE;
+
+		Node.bEnum = true;
+		Node.Enum = ( *Field )->AsArray();
+	}
+
+	if ( const TSharedPtr<FJsonValue>* Field = Object->Values.Find( TEXT( "const" ) ) )
+	{
+		Node.bEnum = true;
+		Node.Enum.Reset();
+		Node.Enum.Add( *Field );
+	}
+
+	for ( const TSharedPtr<FJsonValue>& Entry : Node.Enum )
+	{
+		if ( !Entry.IsValid() || Entry->Type == EJson::Object || Entry->Type == EJson::Array )
+			return INDEX_NONE;
+	}
+
+	if ( const TSharedPtr<FJsonValue>* Field = Object->Values.Find( TEXT( "minimum" ) ) )
+	{
+		if ( ( *Field )->Type != EJson::Number )
+			return INDEX_NONE;
+
+		Node.bMinimum = true;
+		Node.Minimum = ( *Field )->AsNumber();
+	}
+
+	if ( const TSharedPtr<FJsonValue>* Field = Object->Values.Find( TEXT( "maximum" ) ) )
+	{
+		if ( ( *Field )->Type != EJson::Number )
+			return INDEX_NONE;
+
+		Node.bMaximum = true;
+		Node.Maximum = ( *Field )->AsNumber();
+	}
+
+	// exclusive bounds are either a number, or a flag on the inclusive bound in older drafts
+	if ( const TSharedPtr<FJsonValue>* Field = Object->Values.Find( TEXT( "exclusiveMinimum" ) ) )
+	{
+		if ( ( *Field )->Type == EJson::Number )
+		{
+			Node.bMinimum = true;
+			Node.Minimum = ( *Field )->AsNumber();
+			Node.bExclusiveMinimum = true;
+		}
+		else if ( ( *Field )->Type == EJson::Boolean )
+			Node.bExclusiveMinimum = ( *Field )->AsBool();
+		else
+			return INDEX_NONE;
+	}
+
+	if ( const TSharedPtr<FJsonValue>* Field = Object->Values.Find( TEXT( "exclusiveMaximum" ) ) )
+	{
+		if ( ( *Field )->Type == EJson::Number )
+		{
+			Node.bMaximum = true;
+			Node.Maximum = ( *Field )->AsNumber();
+			Node.bExclusiveMaximum = true;
+		}
+		else if ( ( *Field )->Type == EJson::Boolean )
+			Node.bExclusiveMaximum = ( *Field )->AsBool();
+		else
+			return INDEX_NONE;
+	}
+
+	if ( !JsonLibrarySchema::ReadCount( Object, TEXT( "minLength" ), Node.MinLength ) || !JsonLibrarySchema::ReadCount( Object, TEXT( "maxLength" ), Node.MaxLength ) )
+		return INDEX_NONE;
+	if ( !JsonLibrarySchema::ReadCount( Object, TEXT( "minItems" ), Node.MinItems ) || !JsonLibrarySchema::ReadCount( Object, TEXT( "maxItems" ), Node.MaxItems ) )
+		return INDEX_NONE;
+
+	if ( const TSharedPtr<FJsonValue>* Field = Object->Values.Find( TEXT( "properties" ) ) )
+	{
+		if ( ( *Field )->Type != EJson::Object )
+			return INDEX_NONE;
+
+		for ( const TPair<FString, TSharedPtr<FJsonValue>>& Property : ( *Field )->AsObject()->Values )
+		{
+			const int32 Child = CompileNode( Property.Value, OutNodes );
+			if ( Child == INDEX_NONE )
+				return INDEX_NONE;
+
+			Node.Properties.Add( Property.Key, FJsonLibrarySchemaProperty{ Child, INDEX_NONE } );
+		}
+	}
+
+	if ( const TSharedPtr<FJsonValue>* Field = Object->Values.Find( TEXT( "required" ) ) )
+	{
+		if ( ( *Field )->Type != EJson::Array )
+			return INDEX_NONE;
+
+		for ( const TSharedPtr<FJsonValue>& Key : ( *Field )->AsArray() )
+		{
+			if ( !Key.IsValid() || Key->Type != EJson::String )
+				return INDEX_NONE;
+
+			const FString Name = Key->AsString();
+
+			FJsonLibrarySchemaProperty* Property = Node.Properties.Find( Name );
+			if ( !Property )
+				Property = &Node.Properties.Add( Name, FJsonLibrarySchemaProperty{ JsonLibrarySchema::AdditionalNode, INDEX_NONE } );
+
+			if ( Property->Required == INDEX_NONE )
+				Property->Required = Node.Required.Add( Name );
+		}
+	}
+
+	if ( const TSharedPtr<FJsonValue>* Field = Object->Values.Find( TEXT( "additionalProperties" ) ) )
+	{
+		Node.AdditionalProperties = CompileNode( *Field, OutNodes );
+		if ( Node.AdditionalProperties == INDEX_NONE )
+			return INDEX_NONE;
+	}
+
+	// tuple items are not supported, so an array here fails to compile rather than validating loosely
+	if ( const TSharedPtr<FJsonValue>* Field = Object->Values.Find( TEXT( "items" ) ) )
+	{
+		Node.Items = CompileNode( *Field, OutNodes );
+		if ( Node.Items == INDEX_NONE )
+			return INDEX_NONE;
+	}
+
+	OutNodes[ Index ] = MoveTemp( Node );
+	return Index;
+}
+
+bool FJsonLibrarySchema::IsValid() const
+{
+	return Nodes.IsValid();
+}
+
+bool FJsonLibrarySchema::Validate( const FString& Text ) const
+{
+	if ( !Nodes.IsValid() )
+		return false;
+
+	const FJsonLibraryScanner Scanner( Text );
+
+	int32 Pos = 0;
+	Scanner.SkipWhitespace( Pos );
+	if ( !ValidateText( Scanner, Pos, 0, 0, nullptr ) )
+		return false;
+
+	Scanner.SkipWhitespace( Pos );
+	return Pos == Scanner.Length;
+}
+
+bool FJsonLibrarySchema::Validate( const FString& Text, FString& Error ) const
+{
+	Error.Empty();
+	if ( !Nodes.IsValid() )
+	{
+		Error = TEXT( "schema is not compiled" );
+		return false;
+	}
+
+	const FJsonLibraryScanner Scanner( Text );
+
+	int32 Pos = 0;
+	Scanner.SkipWhitespace( Pos );
+	if ( !ValidateText( Scanner, Pos, 0, 0, &Error ) )
+	{
+		JsonLibrarySchema::Finish( &Error );
+		return false;
+	}
+
+	Scanner.SkipWhitespace( Pos );
+	if ( Pos != Scanner.Length )
+	{
+		Error = FString::Printf( TEXT( "invalid JSON at %d" ), Pos );
+		return false;
+	}
+
+	return true;
+}
+
+bool FJsonLibrarySchema::ValidateValue( const FJsonLibraryValue& Value ) const
+{
+	if ( !Nodes.IsValid() )
+		return false;
+
+	return ValidateTree( Value.JsonValue, 0, nullptr );
+}
+
+bool FJsonLibrarySchema::ValidateValue( const FJsonLibraryValue& Value, FString& Error ) const
+{
+	Error.Empty();
+	if ( !Nodes.IsValid() )
+	{
+		Error = TEXT( "schema is not compiled" );
+		return false;
+	}
+
+	if ( !ValidateTree( Value.JsonValue, 0, &Error ) )
+	{
+		JsonLibrarySchema::Finish( &Error );
+		return false;
+	}
+
+	return true;
+}
+
+bool FJsonLibrarySchema::Decode( const FString& Text, const UStruct* StructType, void* StructPtr, FString* Error /*= nullptr*/ ) const
+{
+	if ( !StructType || !StructPtr )
+		return false;
+
+	FString Reason;
+	if ( !Validate( Text, Reason ) )
+	{
+		if ( Error )
+			*Error = Reason;
+
+		return false;
+	}
+
+	// the text is known to be well formed and to match, so the converter reads it straight into the structure
+	if ( !FJsonLibraryConverter::JsonTextToUStruct( Text, StructType, StructPtr ) )
+	{
+		if ( Error )
+			*Error = FString::Printf( TEXT( "could not convert to %s" ), *StructType->GetName() );
+
+		return false;
+	}
+
+	if ( Error )
+		Error->Empty();
+
+	return true;
+}
+
+bool FJsonLibrarySchema::ValidateText( const FJsonLibraryScanner& Scanner, int32& Pos, int32 NodeIndex, int32 Depth, FString* Error ) const
+{
+	if ( NodeIndex == JsonLibrarySchema::AnyNode )
+		return Scanner.Skip( Pos, Depth ) || JsonLibrarySchema::Fail( Error, FString::Printf( TEXT( "invalid JSON at %d" ), Pos ) );
+	if ( NodeIndex == JsonLibrarySchema::NoNode )
+		return JsonLibrarySchema::Fail( Error, TEXT( "not allowed" ) );
+	if ( Depth > FJsonLibraryScanner::MaxDepth )
+		return JsonLibrarySchema::Fail( Error, TEXT( "nested too deeply" ) );
+
+	const FJsonLibrarySchemaNode& Node = ( *Nodes )[ NodeIndex ];
+	const int32 Start = Pos;
+
+	// the checks run as the text is scanned, so a bad value is rejected before the rest is read
+	switch ( Scanner.GetType( Pos ) )
+	{
+		case EJson::Object:
+		{
+			if ( !Node.CheckType( EJson::Object, 0.0, Error ) )
+				return false;
+
+			TBitArray<> Found( false, Node.Required.Num() );
+
+			Pos++;
+			Scanner.SkipWhitespace( Pos );
+			if ( Pos < Scanner.Length && Scanner.Text[ Pos ] == TCHAR( '}' ) )
+			{
+				Pos++;
+				return Node.CheckRequired( Found, Error );
+			}
+
+			FString Key;
+			while ( true )
+			{
+				Key.Reset();
+				if ( !Scanner.ReadString( Pos, &Key ) )
+					break;
+
+				Scanner.SkipWhitespace( Pos );
+				if ( Pos >= Scanner.Length || Scanner.Text[ Pos++ ] != TCHAR( ':' ) )
+					break;
+
+				Scanner.SkipWhitespace( Pos );
+				if ( !ValidateText( Scanner, Pos, Node.GetProperty( Key, Found ), Depth + 1, Error ) )
+					return JsonLibrarySchema::Prefix( Error, Key );
+
+				Scanner.SkipWhitespace( Pos );
+				if ( Pos >= Scanner.Length )
+					break;
+
+				const TCHAR Char = Scanner.Text[ Pos++ ];
+				if ( Char == TCHAR( '}' ) )
+					return Node.CheckRequired( Found, Error );
+				if ( Char != TCHAR( ',' ) )
+					break;
+
+				Scanner.SkipWhitespace( Pos );
+			}
+
+			break;
+		}
+		case EJson::Array:
+		{
+			if ( !Node.CheckType( EJson::Array, 0.0, Error ) )
+				return false;
+
+			int32 Count = 0;
+
+			Pos++;
+			Scanner.SkipWhitespace( Pos );
+			if ( Pos < Scanner.Length && Scanner.Text[ Pos ] == TCHAR( ']' ) )
+			{
+				Pos++;
+				return Node.CheckItems( Count, Error );
+			}
+
+			while ( true )
+			{
+				if ( !ValidateText( Scanner, Pos, Node.Items, Depth + 1, Error ) )
+					return JsonLibrarySchema::Prefix( Error, FString::FromInt( Count ) );
+
+				// fail as soon as there are too many, rather than at the end
+				if ( ++Count > Node.MaxItems )
+					return Node.CheckItems( Count, Error );
+
+				Scanner.SkipWhitespace( Pos );
+				if ( Pos >= Scanner.Length )
+					break;
+
+				const TCHAR Char = Scanner.Text[ Pos++ ];
+				if ( Char == TCHAR( ']' ) )
+					return Node.CheckItems( Count, Error );
+				if ( Char != TCHAR( ',' ) )
+					break;
+
+				Scanner.SkipWhitespace( Pos );
+			}
+
+			break;
+		}
+		case EJson::String:
+		{
+			if ( !Node.CheckType( EJson::String, 0.0, Error ) )
+				return false;
+
+			// the string is only unescaped when something needs to look at it
+			if ( !Node.NeedsString() )
+			{
+				if ( !Scanner.ReadString( Pos, nullptr ) )
+					break;
+
+				return true;
+			}
+
+			FString Value;
+			if ( !Scanner.ReadString( Pos, &Value ) )
+				break;
+
+			return Node.CheckLength( Value.Len(), Error ) && Node.CheckEnum( EJson::String, false, 0.0, Value, Error );
+		}
+		case EJson::Boolean:
+		{
+			const bool bValue = Scanner.Text[ Pos ] == TCHAR( 't' );
+			if ( !Scanner.SkipLiteral( Pos, bValue ? TEXT( "true" ) : TEXT( "false" ) ) )
+				break;
+
+			return Node.CheckType( EJson::Boolean, 0.0, Error ) && Node.CheckEnum( EJson::Boolean, bValue, 0.0, FString(), Error );
+		}
+		case EJson::Null:
+		{
+			if ( !Scanner.SkipLiteral( Pos, TEXT( "null" ) ) )
+				break;
+
+			return Node.CheckType( EJson::Null, 0.0, Error ) && Node.CheckEnum( EJson::Null, false, 0.0, FString(), Error );
+		}
+		case EJson::Number:
+		{
+			double Value = 0.0;
+			if ( !Scanner.ReadNumber( Pos, Value ) )
+				break;
+
+			return Node.CheckType( EJson::Number, Value, Error ) && Node.CheckNumber( Value, Error ) && Node.CheckEnum( EJson::Number, false, Value, FString(), Error );
+		}
+	}
+
+	return JsonLibrarySchema::Fail( Error, FString::Printf( TEXT( "invalid JSON at %d" ), FMath::Max( Pos, Start ) ) );
+}
+
+bool FJsonLibrarySchema::ValidateTree( const TSharedPtr<FJsonValue>& Value, int32 NodeIndex, FString* Error ) const
+{
+	if ( NodeIndex == JsonLibrarySchema::AnyNode )
+		return true;
+	if ( NodeIndex == JsonLibrarySchema::NoNode )
+		return JsonLibrarySchema::Fail( Error, TEXT( "not allowed" ) );
+
+	const FJsonLibrarySchemaNode& Node = ( *Nodes )[ NodeIndex ];
+	if ( !Value.IsValid() )
+		return Node.CheckType( EJson::Null, 0.0, Error ) && Node.CheckEnum( EJson::Null, false, 0.0, FString(), Error );
+
+	switch ( Value->Type )
+	{
+		case EJson::Object:
+		{
+			if ( !Node.CheckType( EJson::Object, 0.0, Error ) )
+				return false;
+
+			const TSharedPtr<FJsonObject> Object = Value->AsObject();
+			if ( !Object.IsValid() )
+				return true;
+
+			TBitArray<> Found( false, Node.Required.Num() );
+			for ( const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object->Values )
+			{
+				if ( !ValidateTree( Field.Value, Node.GetProperty( Field.Key, Found ), Error ) )
+					return JsonLibrarySchema::Prefix( Error, Field.Key );
+			}
+
+			return Node.CheckRequired( Found, Error );
+		}
+		case EJson::Array:
+		{
+			if ( !Node.CheckType( EJson::Array, 0.0, Error ) )
+				return false;
+
+			const TArray<TSharedPtr<FJsonValue>>& Array = Value->AsArray();
+			if ( !Node.CheckItems( Array.Num(), Error ) )
+				return false;
+
+			for ( int32 i = 0; i < Array.Num(); i++ )
+			{
+				if ( !ValidateTree( Array[ i ], Node.Items, Error ) )
+					return JsonLibrarySchema::Prefix( Error, FString::FromInt( i ) );
+			}
+
+			return true;
+		}
+		case EJson::String:
+		{
+			const FString String = Value->AsString();
+			return Node.CheckType( EJson::String, 0.0, Error ) && Node.CheckLength( String.Len(), Error ) && Node.CheckEnum( EJson::String, false, 0.0, String, Error );
+		}
+		case EJson::Boolean:
+			return Node.CheckType( EJson::Boolean, 0.0, Error ) && Node.CheckEnum( EJson::Boolean, Value->AsBool(), 0.0, FString(), Error );
+		case EJson::Number:
+		{
+			const double Number = Value->AsNumber();
+			return Node.CheckType( EJson::Number, Number, Error ) && Node.CheckNumber( Number, Error ) && Node.CheckEnum( EJson::Number, false, Number, FString(), Error );
+		}
+	}
+
+	return Node.CheckType( EJson::Null, 0.0, Error ) && Node.CheckEnum( EJson::Null, false, 0.0, FString(), Error );
+}
@@ -3,6 +3,9 @@
 #include "JsonLibraryObject.h"
 #include "JsonLibraryList.h"
 #include "JsonLibraryHelpers.h"
+#include "JsonLibraryCbor.h"
+#include "JsonLibraryIndex.h"
+#include "Templates/Atomic.h"
 #include "Policies/CondensedJsonPrintPolicy.h"
 #include "Policies/PrettyJsonPrintPolicy.h"
 
@@ -161,6 +164,11 @@ EJsonLibraryType FJsonLibraryValue::GetType() const
 	return EJsonLibraryType::Invalid;
 }
 
+uint32 FJsonLibraryValue::GetHash() const
+{
+	return FJsonLibraryIndex::Hash( JsonValue );
+}
+
 bool FJsonLibraryValue::Equals( const FJsonLibraryValue& Value, bool bStrict /*= false*/ ) const
 {
 	if ( !JsonValue.IsValid() )
@@ -308,6 +316,76 @@ int32 FJsonLibraryValue::GetInteger() const
 	return (int32)GetNumber();
 }
 
+// Tells plain string values apart from other string values, such as number strings.
+// GetType builds a new string on every call, so its answer is cached per virtual table; a class is only asked once for each module it was built in.
+struct FJsonLibraryValueType : public FJsonValue
+{
+	static bool IsPlainString( const FJsonValue& Value )
+	{
+		if ( Value.Type != EJson::String )
+			return false;
+
+		static TAtomic<const void*> PlainTables[ 4 ];
+		static TAtomic<const void*> OtherTables[ 4 ];
+
+		const void* Table = *reinterpret_cast<const void* const*>( &Value );
+		if ( IsCached( PlainTables, Table ) )
+			return true;
+		if ( IsCached( OtherTables, Table ) )
+			return false;
+
+		const bool bPlain = ( Value.*( &FJsonLibraryValueType::GetType ) )() == TEXT( "String" );
+		Cache( bPlain ? PlainTables : OtherTables, Table );
+
+		return bPlain;
+	}
+
+private:
+
+	static bool IsCached( const TAtomic<const void*> ( &Tables )[ 4 ], const void* Table )
+	{
+		for ( const TAtomic<const void*>& Cached : Tables )
+		{
+			const void* Temp = Cached.Load();
+			if ( Temp == Table )
+				return true;
+			if ( !Temp )
+				break;
+		}
+
+		return false;
+	}
+
+	static void Cache( TAtomic<const void*> ( &Tables )[ 4 ], const void* Table )
+	{
+		// once every slot is taken, further tables are simply asked every time
+		for ( TAtomic<const void*>& Cached : Tables )
+		{
+			const void* Expected = nullptr;
+			if ( Cached.CompareExchange( Expected, Table ) || Expected == Table )
+				break;
+		}
+	}
+};
+
+// Reads the text of a string value without copying it.
+struct FJsonLibraryValueString : public FJsonValueString
+{
+	static const FString& Get( const FJsonValueString& Value )
+	{
+		return Value.*( &FJsonLibraryValueString::Value );
+	}
+};
+
+FStringView FJsonLibraryValue::GetStringView() const
+{
+	// other string values, such as number strings, have no text member to view
+	if ( !JsonValue.IsValid() || !FJsonLibraryValueType::IsPlainString( *JsonValue ) )
+		return FStringView();
+
+	return FJsonLibraryValueString::Get( static_cast<const FJsonValueString&>( *JsonValue ) );
+}
+
 FString FJsonLibraryValue::GetString() const
 {
 	if ( !JsonValue.IsValid() )
@@ -696,6 +774,41 @@ FString FJsonLibraryValue::Stringify( bool bCondensed /*= true*/ ) const
 	return FString();
 }
 
+bool FJsonLibraryValue::TryParseCbor( const TArray<uint8>& Data )
+{
+	if ( Data.Num() <= 0 )
+		return false;
+
+	TSharedPtr<FJsonValue> Value;
+	FJsonLibraryCborReader Reader( Data.GetData(), Data.Num() );
+	if ( !Reader.ReadValue( Value ) || !Reader.IsDone() )
+		return false;
+
+	JsonValue = Value;
+	return true;
+}
+
+FJsonLibraryValue FJsonLibraryValue::ParseCbor( const TArray<uint8>& Data )
+{
+	FJsonLibraryValue Value = TSharedPtr<FJsonValue>();
+	if ( !Value.TryParseCbor( Data ) )
+		Value.JsonValue.Reset();
+
+	return Value;
+}
+
+TArray<uint8> FJsonLibraryValue::EncodeCbor( bool bTypedArrays /*= true*/ ) const
+{
+	TArray<uint8> Data;
+	if ( !JsonValue.IsValid() )
+		return Data;
+
+	FJsonLibraryCborWriter Writer( Data, bTypedArrays );
+	Writer.WriteValue( JsonValue );
+
+	return Data;
+}
+
 TArray<FJsonLibraryValue> FJsonLibraryValue::ToArray() const
 {
 	return FJsonLibraryList( JsonValue ).ToArray();
@@ -0,0 +1,123 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibrary.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FJsonLibraryObjectBatchCopyTest, "JsonLibrary.Object.BatchCopy", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter )
+
+bool FJsonLibraryObjectBatchCopyTest::RunTest( const FString& Parameters )
+{
+	FJsonLibraryObject Object;
+	Object.BeginNotifyBatch();
+
+	// copies made inside a batch share the object but not the batch
+	FJsonLibraryObject Copy( Object );
+	FJsonLibraryObject Assigned;
+	Assigned = Object;
+
+	TestTrue( TEXT( "Original is batching" ), Object.IsNotifyBatching() );
+	TestFalse( TEXT( "Copy is not batching" ), Copy.IsNotifyBatching() );
+	TestFalse( TEXT( "Assigned copy is not batching" ), Assigned.IsNotifyBatching() );
+
+	Copy.SetString( "name", "value" );
+	TestEqual( TEXT( "Copy shares the object" ), Object.GetString( "name" ), FString( "value" ) );
+
+	Object.EndNotifyBatch();
+	TestFalse( TEXT( "Batch is closed" ), Object.IsNotifyBatching() );
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FJsonLibraryPatchCaseTest, "JsonLibrary.Patch.Case", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter )
+
+bool FJsonLibraryPatchCaseTest::RunTest( const FString& Parameters )
+{
+	FJsonLibraryObject Source;
+	Source.SetString( "name", "abc" );
+
+	FJsonLibraryObject Target;
+	Target.SetString( "name", "ABC" );
+
+	// a change in case alone is still a change
+	const FJsonLibraryList Patch = Source.CreatePatch( Target );
+	TestEqual( TEXT( "Patch has one operation" ), Patch.Count(), 1 );
+
+	FJsonLibraryObject Patched = FJsonLibraryObject::Parse( Source.Stringify() );
+	TestTrue( TEXT( "Patch applies" ), Patched.ApplyPatch( Patch ) );
+	TestEqual( TEXT( "Patch changes the case" ), Patched.GetString( "name" ), FString( "ABC" ) );
+
+	const FJsonLibraryObject MergePatch = Source.CreateMergePatch( Target );
+	TestEqual( TEXT( "Merge patch has one property" ), MergePatch.Count(), 1 );
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FJsonLibraryListIndexTest, "JsonLibrary.List.Index", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter )
+
+bool FJsonLibraryListIndexTest::RunTest( const FString& Parameters )
+{
+	FJsonLibraryObject Item;
+	Item.SetInteger( "x", 1 );
+
+	FJsonLibraryObject Root;
+	Root.SetList( "items", FJsonLibraryList() );
+
+	FJsonLibraryList Indexed = Root.GetList( "items" );
+	Indexed.SetIndexed( true );
+	Indexed.AddString( "a" );
+	Indexed.AddObject( Item );
+
+	TestEqual( TEXT( "Find string" ), Indexed.FindString( "a" ), 0 );
+	TestEqual( TEXT( "Strings match case-sensitively" ), Indexed.FindString( "A" ), -1 );
+
+	// changes made through another handle to the same array
+	FJsonLibraryList Other = Root.GetList( "items" );
+	Other.SetString( 0, "b" );
+	Other.GetObject( 1 ).SetInteger( "x", 2 );
+
+	TestEqual( TEXT( "Replaced item is found" ), Indexed.FindString( "b" ), 0 );
+	TestEqual( TEXT( "Old item is gone" ), Indexed.FindString( "a" ), -1 );
+
+	FJsonLibraryObject Changed;
+	Changed.SetInteger( "x", 2 );
+	TestEqual( TEXT( "Object changed in place is found" ), Indexed.FindObject( Changed ), 1 );
+
+	FJsonLibraryObject Original;
+	Original.SetInteger( "x", 1 );
+	TestEqual( TEXT( "Old object contents are gone" ), Indexed.FindObject( Original ), -1 );
+
+	// positions move with inserts and removes
+	Indexed.InsertObject( 0, Original );
+	Indexed.AddObject( Original );
+	TestEqual( TEXT( "Inserted object is found first" ), Indexed.FindObject( Original ), 0 );
+	TestEqual( TEXT( "Shifted object is found" ), Indexed.FindObject( Changed ), 2 );
+	TestEqual( TEXT( "Shifted string is found" ), Indexed.FindString( "b" ), 1 );
+
+	Indexed.Remove( 1 );
+	TestEqual( TEXT( "Object after a removed item is found" ), Indexed.FindObject( Changed ), 1 );
+	TestEqual( TEXT( "Later duplicate is found" ), Indexed.FindObject( Original, 1 ), 2 );
+	TestEqual( TEXT( "Removed string is gone" ), Indexed.FindString( "b" ), -1 );
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FJsonLibrarySchemaKeywordTest, "JsonLibrary.Schema.Keywords", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter )
+
+bool FJsonLibrarySchemaKeywordTest::RunTest( const FString& Parameters )
+{
+	TestFalse( TEXT( "Unsupported keyword fails" ), FJsonLibrarySchema::Compile( FString( TEXT( "{\"type\":\"string\",\"pattern\":\"^a\"}" ) ) ).IsValid() );
+	TestFalse( TEXT( "Nested unsupported keyword fails" ), FJsonLibrarySchema::Compile( FString( TEXT( "{\"properties\":{\"a\":{\"oneOf\":[]}}}" ) ) ).IsValid() );
+
+	const FJsonLibrarySchema Schema = FJsonLibrarySchema::Compile( FString( TEXT( "{\"title\":\"Named\",\"type\":\"object\",\"required\":[\"name\"]}" ) ) );
+	TestTrue( TEXT( "Annotations compile" ), Schema.IsValid() );
+
+	// property names are case-sensitive
+	TestTrue( TEXT( "Exact key is accepted" ), Schema.Validate( TEXT( "{\"name\":1}" ) ) );
+	TestFalse( TEXT( "Key in another case is rejected" ), Schema.Validate( TEXT( "{\"Name\":1}" ) ) );
+	TestFalse( TEXT( "Key in another case is rejected as a value" ), Schema.ValidateValue( FJsonLibraryValue::Parse( TEXT( "{\"Name\":1}" ) ) ) );
+
+	return true;
+}
+
+#endif
@@ -4,4 +4,10 @@
 #include "JsonLibraryValue.h"
 #include "JsonLibraryObject.h"
 #include "JsonLibraryList.h"
+#include "JsonLibraryQuery.h"
+#include "JsonLibraryDocument.h"
+#include "JsonLibraryFrozen.h"
+#include "JsonLibrarySchema.h"
+#include "JsonLibraryLoadFile.h"
+#include "JsonLibraryLines.h"
 #include "JsonLibraryHelpers.h"
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "JsonLibraryObject.h"
+#include "JsonLibraryList.h"
+#include "JsonLibrarySchema.h"
 #include "JsonLibraryBlueprintHelpers.generated.h"
 
 USTRUCT(BlueprintInternalUseOnly)
@@ -19,6 +21,16 @@ struct FStructBase
 	}
 };
 
+struct FJsonLibraryIteratorState;
+
+USTRUCT(BlueprintInternalUseOnly)
+struct FJsonLibraryIterator
+{
+	GENERATED_USTRUCT_BODY()
+
+	TSharedPtr<FJsonLibraryIteratorState> State;
+};
+
 UCLASS()
 class JSONLIBRARY_API UJsonLibraryBlueprintHelpers : public UBlueprintFunctionLibrary
 {
@@ -30,11 +42,21 @@ public:
     static bool StructFromJson( const UScriptStruct* StructType, const FJsonLibraryObject& Object, FStructBase& OutStruct );
 	UFUNCTION(BlueprintCallable, CustomThunk, Category = "JSON Library", meta=(CustomStructureParam = "Struct", BlueprintInternalUseOnly="true"))
     static FJsonLibraryObject StructToJson( const UScriptStruct* StructType, const FStructBase& Struct );
+	// Validate a JSON string against a schema and read it straight into a structure.
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "JSON Library|Schema", meta=(DisplayName = "Decode JSON With Schema", CustomStructureParam = "OutStruct"))
+    static bool StructFromJsonSchema( const FJsonLibrarySchema& Schema, const FString& Text, FStructBase& OutStruct, FString& Error );
 
 	UFUNCTION(BlueprintCallable, Category = "JSON Library", meta=(BlueprintInternalUseOnly="true"))
 	static FJsonLibraryObject ConstructInvalidObject();
 	UFUNCTION(BlueprintPure, Category = "JSON Library", meta=(BlueprintInternalUseOnly="true"))
 	static bool IsValidObject( const FJsonLibraryObject& Object );
+
+	UFUNCTION(BlueprintCallable, Category = "JSON Library", meta=(BlueprintInternalUseOnly="true"))
+	static FJsonLibraryIterator IterateList( const FJsonLibraryList& Target );
+	UFUNCTION(BlueprintCallable, Category = "JSON Library", meta=(BlueprintInternalUseOnly="true"))
+	static FJsonLibraryIterator IterateObject( const FJsonLibraryObject& Target );
+	UFUNCTION(BlueprintCallable, Category = "JSON Library", meta=(BlueprintInternalUseOnly="true"))
+	static bool IteratorNext( const FJsonLibraryIterator& Iterator, int32& Index, FString& Key, FJsonLibraryValue& Value );
     
 	static bool Generic_StructFromJson( const UScriptStruct* StructType, const FJsonLibraryObject& Object, void* OutStructPtr );
     DECLARE_FUNCTION( execStructFromJson )
@@ -74,5 +96,27 @@ public:
 		*(FJsonLibraryObject*)RESULT_PARAM = bSuccess ? OutObject : ConstructInvalidObject();
     }
 
+	static bool Generic_StructFromJsonSchema( const FJsonLibrarySchema& Schema, const FString& Text, const UScriptStruct* StructType, void* OutStructPtr, FString& Error );
+    DECLARE_FUNCTION( execStructFromJsonSchema )
+    {
+        P_GET_STRUCT_REF( FJsonLibrarySchema, Schema );
+        P_GET_PROPERTY( FStrProperty, Text );
+
+		Stack.StepCompiledIn<FStructProperty>( NULL );
+		void* OutStructPtr = Stack.MostRecentPropertyAddress;
+		FStructProperty* OutStructProperty = CastField<FStructProperty>( Stack.MostRecentProperty );
+
+		P_GET_PROPERTY_REF( FStrProperty, Error );
+
+		P_FINISH;
+		bool bSuccess = false;
+
+		P_NATIVE_BEGIN;
+		bSuccess = Generic_StructFromJsonSchema( Schema, Text, OutStructProperty ? OutStructProperty->Struct : nullptr, OutStructPtr, Error );
+		P_NATIVE_END;
+
+		*(bool*)RESULT_PARAM = bSuccess;
+    }
+
 	static bool InitializeStructData( const FJsonLibraryObject& Object, const UScriptStruct* StructType, FStructOnScope& StructData );
 };
@@ -0,0 +1,148 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonTypes.h"
+
+// Streaming CBOR (RFC 8949) writer, shaped like TJsonWriter.
+class JSONLIBRARY_API FJsonLibraryCborWriter
+{
+public:
+
+	// Append to a byte array; numeric lists are written as typed arrays (RFC 8746) when allowed.
+	FJsonLibraryCborWriter( TArray<uint8>& InData, bool bInTypedArrays = true );
+
+	// Write the key of the next object member.
+	void WriteIdentifier( const FString& Identifier );
+
+	// Start an object of unknown size.
+	void WriteObjectStart();
+	void WriteObjectStart( const FString& Identifier );
+	// End the current object.
+	void WriteObjectEnd();
+
+	// Start an array of unknown size.
+	void WriteArrayStart();
+	void WriteArrayStart( const FString& Identifier );
+	// End the current array.
+	void WriteArrayEnd();
+
+	// Write a null value.
+	void WriteNull();
+	void WriteNull( const FString& Identifier );
+
+	// Write a scalar value.
+	void WriteValue( bool Value );
+	void WriteValue( float Value );
+	void WriteValue( double Value );
+	void WriteValue( int32 Value );
+	void WriteValue( int64 Value );
+	void WriteValue( const FString& Value );
+	void WriteValue( const TCHAR* Value );
+	// Write a complete JSON value.
+	void WriteValue( const TSharedPtr<FJsonValue>& Value );
+
+	// Write a member of the current object.
+	template<typename ValueType>
+	void WriteValue( const FString& Identifier, ValueType Value )
+	{
+		WriteIdentifier( Identifier );
+		WriteValue( Value );
+	}
+
+	// Write an array of floats as a float32 typed array.
+	void WriteFloatArray( const float* Values, int32 Num );
+	void WriteFloatArray( const FString& Identifier, const TArray<float>& Values );
+	// Write an array of numbers as a float64 typed array.
+	void WriteNumberArray( const double* Values, int32 Num );
+	void WriteNumberArray( const FString& Identifier, const TArray<double>& Values );
+
+private:
+
+	TArray<uint8>& Data;
+	bool bTypedArrays;
+
+	void WriteHead( uint8 Major, uint64 Value );
+	void WriteInteger( int64 Value );
+	void WriteFloat32( float Value );
+	void WriteFloat64( double Value );
+	void WriteString( const TCHAR* Value, int32 Length );
+	void WriteTypedArray( uint8 Tag, const void* Values, int32 Num, int32 ElementSize );
+	void WriteJsonArray( const TArray<TSharedPtr<FJsonValue>>& Values );
+};
+
+// Streaming CBOR (RFC 8949) reader, shaped like TJsonReader.
+class JSONLIBRARY_API FJsonLibraryCborReader
+{
+public:
+
+	// Read from a byte array, which must outlive the reader.
+	FJsonLibraryCborReader( const uint8* InData, int32 InSize );
+
+	// Read the next token; returns false at the end of the data or on error.
+	bool ReadNext( EJsonNotation& Notation );
+
+	// Key of the last token, when inside an object.
+	const FString& GetIdentifier() const { return Identifier; }
+	// Value of the last string token.
+	const FString& GetValueAsString() const { return StringValue; }
+	// Value of the last number token.
+	double GetValueAsNumber() const { return NumberValue; }
+	// Value of the last boolean token.
+	bool GetValueAsBoolean() const { return bBooleanValue; }
+
+	// Check if the last array start is a typed numeric array.
+	bool IsTypedArray() const;
+	// Read the rest of the current array, including its end, into an array of floats.
+	bool ReadFloatArray( TArray<float>& Array );
+	// Read the rest of the current array, including its end, into an array of numbers.
+	bool ReadNumberArray( TArray<double>& Array );
+
+	// Read the next complete value.
+	bool ReadValue( TSharedPtr<FJsonValue>& Value );
+
+	// Check if all data has been read.
+	bool IsDone() const { return Offset >= Size && Stack.Num() == 0; }
+	// Get a description of the last error.
+	const FString& GetErrorMessage() const { return ErrorMessage; }
+
+private:
+
+	struct FFrame
+	{
+		bool bObject;
+		// Remaining items, or -1 until a break code.
+		int64 Remaining;
+
+		// Typed array elements.
+		const uint8* Elements;
+		uint8 ElementSize;
+		bool bFloat;
+		bool bSigned;
+		bool bLittleEndian;
+	};
+
+	const uint8* Data;
+	int32 Size;
+	int32 Offset;
+
+	TArray<FFrame> Stack;
+
+	FString Identifier;
+	FString StringValue;
+	double NumberValue;
+	bool bBooleanValue;
+
+	FString ErrorMessage;
+
+	bool Fail( const TCHAR* Message );
+	bool ReadHead( uint8& Major, uint8& Additional, uint64& Value );
+	bool ReadBytes( uint8 Major, uint8 Additional, uint64 Length, TArray<uint8>& Bytes );
+	bool ReadKey();
+	bool ReadItem( EJsonNotation& Notation );
+	bool ReadTypedElement( FFrame& Frame );
+	int32 GetReserveNum( const FFrame& Frame ) const;
+	bool ReadValue( EJsonNotation Notation, TSharedPtr<FJsonValue>& Value );
+	template<typename NumberType>
+	bool ReadTypedArray( TArray<NumberType>& Array );
+};
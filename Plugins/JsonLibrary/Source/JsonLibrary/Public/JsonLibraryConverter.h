@@ -23,6 +23,9 @@ public:
 	/** Convert a Json value to text (takes some hints from the value name) */
 	static bool GetTextFromField(const FString& FieldName, const TSharedPtr<FJsonValue>& FieldValue, FText& TextOut);
 
+	/** Discard the cached per-UStruct conversion plans (property offsets, JSON keys and typed thunks). Called after hot reload. */
+	static void ResetCachedPlans();
+
 public: // UStruct -> JSON
 
 	/**
@@ -308,4 +311,64 @@ public: // JSON -> UStruct
 	* @param JsonObject Object to parse arguments from
 	*/
 	static FFormatNamedArguments ParseTextArgumentsFromJson(const TSharedPtr<const FJsonObject>& JsonObject);
+
+public: // UStruct <-> JSON text
+
+	/**
+	 * Writes a UStruct straight to condensed json text, without building an intermediate FJsonObject.
+	 * Properties without a direct writer (maps, sets, enums, objects, text...) are converted through UPropertyToJsonValue one value at a time.
+	 *
+	 * @param StructDefinition UStruct definition that is looked over for properties
+	 * @param Struct The UStruct instance to copy out of
+	 * @param OutJsonString Json text to be filled in; it is reset but keeps its allocation
+	 * @param CheckFlags Only convert properties that match at least one of these flags. If 0 check all properties.
+	 * @param SkipFlags Skip properties that match any of these flags
+	 *
+	 * @return False if any properties failed to write
+	 */
+	static bool UStructToJsonText(const UStruct* StructDefinition, const void* Struct, FString& OutJsonString, int64 CheckFlags = 0, int64 SkipFlags = 0);
+
+	/**
+	 * Writes a UStruct straight to condensed UTF-8 json text (not null terminated), ready to hand to sockets or files.
+	 */
+	static bool UStructToJsonText(const UStruct* StructDefinition, const void* Struct, TArray<uint8>& OutJsonUtf8, int64 CheckFlags = 0, int64 SkipFlags = 0);
+
+	/**
+	 * Templated version of UStructToJsonText
+	 */
+	template<typename InStructType>
+	static bool UStructToJsonText(const InStructType& InStruct, FString& OutJsonString, int64 CheckFlags = 0, int64 SkipFlags = 0)
+	{
+		return UStructToJsonText(InStructType::StaticStruct(), &InStruct, OutJsonString, CheckFlags, SkipFlags);
+	}
+
+	/**
+	 * Reads json text containing an object straight into a UStruct, without building an intermediate FJsonObject.
+	 * Keys that don't match a property and null values are ignored, as with JsonObjectToUStruct.
+	 *
+	 * @param JsonText Json text to read
+	 * @param Length Number of characters in JsonText
+	 * @param StructDefinition UStruct definition that is looked over for properties
+	 * @param OutStruct The UStruct instance to copy in to
+	 * @param CheckFlags Only convert properties that match at least one of these flags. If 0 check all properties.
+	 * @param SkipFlags Skip properties that match any of these flags
+	 *
+	 * @return False if the text is not a valid json object or any properties failed to read
+	 */
+	static bool JsonTextToUStruct(const TCHAR* JsonText, int32 Length, const UStruct* StructDefinition, void* OutStruct, int64 CheckFlags = 0, int64 SkipFlags = 0);
+	static bool JsonTextToUStruct(const FString& JsonString, const UStruct* StructDefinition, void* OutStruct, int64 CheckFlags = 0, int64 SkipFlags = 0);
+
+	/**
+	 * Reads UTF-8 json text containing an object straight into a UStruct. A leading byte order mark is skipped.
+	 */
+	static bool JsonTextToUStruct(const uint8* JsonUtf8, int32 Length, const UStruct* StructDefinition, void* OutStruct, int64 CheckFlags = 0, int64 SkipFlags = 0);
+
+	/**
+	 * Templated version of JsonTextToUStruct
+	 */
+	template<typename OutStructType>
+	static bool JsonTextToUStruct(const FString& JsonString, OutStructType* OutStruct, int64 CheckFlags = 0, int64 SkipFlags = 0)
+	{
+		return JsonTextToUStruct(JsonString, OutStructType::StaticStruct(), OutStruct, CheckFlags, SkipFlags);
+	}
 };
@@ -0,0 +1,66 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+#include "JsonLibraryEnums.h"
+#include "JsonLibraryValue.h"
+#include "JsonLibraryObject.h"
+#include "JsonLibraryList.h"
+#include "JsonLibraryDocument.generated.h"
+
+struct FJsonLibraryDocumentNode;
+
+USTRUCT(BlueprintType, meta = (DisplayName = "JSON Document"))
+struct JSONLIBRARY_API FJsonLibraryDocument
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+
+	FJsonLibraryDocument();
+
+	// Validate a JSON string without building any values; fields are indexed and built on first access.
+	static FJsonLibraryDocument Parse( const FString& Text );
+
+	// Check if this document is valid.
+	bool IsValid() const;
+	// Get the JSON type of this document.
+	EJsonLibraryType GetType() const;
+
+	// Get the number of fields or items in this document.
+	int32 Count() const;
+	// Check if this document has a field.
+	bool HasKey( const FString& Key ) const;
+	// Get the keys of this document.
+	TArray<FString> GetKeys() const;
+
+	// Get a field of this document, without building it.
+	FJsonLibraryDocument GetField( const FString& Key ) const;
+	// Get an item of this document, without building it.
+	FJsonLibraryDocument GetItem( int32 Index ) const;
+
+	// Read this document as a boolean.
+	bool GetBoolean() const;
+	// Read this document as a float.
+	float GetFloat() const;
+	// Read this document as an integer.
+	int32 GetInteger() const;
+	// Read this document as a number.
+	double GetNumber() const;
+	// Read this document as a string.
+	FString GetString() const;
+
+	// Build this document as a JSON value; the result is cached.
+	FJsonLibraryValue GetValue() const;
+	// Build this document as a JSON object; the result is cached.
+	FJsonLibraryObject GetObject() const;
+	// Build this document as a JSON array; the result is cached.
+	FJsonLibraryList GetList() const;
+
+	// Get the JSON text of this document.
+	FString Stringify() const;
+
+private:
+
+	TSharedPtr<FJsonLibraryDocumentNode> Node;
+};
@@ -0,0 +1,68 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+#include "JsonLibraryEnums.h"
+#include "JsonLibraryValue.h"
+#include "JsonLibraryFrozen.generated.h"
+
+struct FJsonLibraryFrozenRoot;
+
+// Immutable JSON value that can be copied and read from any thread without locks.
+USTRUCT(BlueprintType, meta = (DisplayName = "JSON Frozen"))
+struct JSONLIBRARY_API FJsonLibraryFrozen
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+
+	FJsonLibraryFrozen();
+
+	// Freeze a copy of a JSON value, object or list.
+	static FJsonLibraryFrozen Freeze( const FJsonLibraryValue& Value );
+	// Parse a JSON string straight into a frozen value, without a copy.
+	static FJsonLibraryFrozen Parse( const FString& Text );
+
+	// Get a mutable copy of this value; only this value and its children are copied.
+	FJsonLibraryValue Thaw() const;
+
+	// Check if this value is valid.
+	bool IsValid() const;
+	// Get the JSON type of this value.
+	EJsonLibraryType GetType() const;
+
+	// Get the number of fields or items in this value.
+	int32 Count() const;
+	// Check if this value has a field.
+	bool HasKey( const FString& Key ) const;
+	// Get the keys of this value.
+	TArray<FString> GetKeys() const;
+
+	// Get a field of this value.
+	FJsonLibraryFrozen GetField( const FString& Key ) const;
+	// Get an item of this value.
+	FJsonLibraryFrozen GetItem( int32 Index ) const;
+
+	// Convert this value to a boolean.
+	bool GetBoolean() const;
+	// Convert this value to a float.
+	float GetFloat() const;
+	// Convert this value to an integer.
+	int32 GetInteger() const;
+	// Convert this value to a number.
+	double GetNumber() const;
+	// Convert this value to a string.
+	FString GetString() const;
+
+	// Stringify this value as a JSON string.
+	FString Stringify( bool bCondensed = true ) const;
+
+private:
+
+	// Owns the frozen tree; none of its nodes are shared with mutable values.
+	TSharedPtr<const FJsonLibraryFrozenRoot, ESPMode::ThreadSafe> Root;
+	// Node within the frozen tree; readers never copy its non thread-safe pointers.
+	const FJsonValue* JsonValue;
+
+	FJsonLibraryFrozen( const TSharedPtr<const FJsonLibraryFrozenRoot, ESPMode::ThreadSafe>& InRoot, const FJsonValue* InJsonValue );
+};
@@ -5,6 +5,10 @@
 #include "JsonLibraryValue.h"
 #include "JsonLibraryObject.h"
 #include "JsonLibraryList.h"
+#include "JsonLibraryQuery.h"
+#include "JsonLibraryDocument.h"
+#include "JsonLibraryFrozen.h"
+#include "JsonLibrarySchema.h"
 #include "JsonLibraryHelpers.generated.h"
 
 UCLASS()
@@ -29,6 +33,14 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Parse List", AutoCreateRefTerm = "Notify", AdvancedDisplay = "Notify"), Category = "JSON Library|List")
 	static FJsonLibraryList ParseList( const FString& Text, const FJsonLibraryListNotify& Notify );
 
+	// Parse CBOR data.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Parse CBOR"), Category = "JSON Library")
+	static FJsonLibraryValue ParseCbor( const TArray<uint8>& Data );
+
+	// Parse a JSON string lazily; fields are indexed and built on first access.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Parse Document"), Category = "JSON Library|Document")
+	static FJsonLibraryDocument ParseDocument( const FString& Text );
+
 	// Construct a JSON null.
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Construct null", CompactNodeTitle = "null"), Category = "JSON Library")
 	static FJsonLibraryValue ConstructNull();
@@ -36,6 +48,9 @@ public:
 	// Construct a JSON object.
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Construct Object", CompactNodeTitle = "JSON", AutoCreateRefTerm = "Notify"), Category = "JSON Library")
 	static FJsonLibraryObject ConstructObject( const FJsonLibraryObjectNotify& Notify );
+	// Construct a JSON object that notifies changes in batches.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Construct Batched Object", CompactNodeTitle = "JSON", AutoCreateRefTerm = "Notify"), Category = "JSON Library")
+	static FJsonLibraryObject ConstructBatchedObject( const FJsonLibraryObjectBatchNotify& Notify );
 	// Construct a JSON array.
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Construct List", CompactNodeTitle = "JSON", AutoCreateRefTerm = "Notify"), Category = "JSON Library")
 	static FJsonLibraryList ConstructList( const FJsonLibraryListNotify& Notify );
@@ -390,6 +405,18 @@ public:
 	// Copy an array of floats to a JSON array.
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Copy Float Array To List"), Category = "JSON Library|Array")
 	static FJsonLibraryList ConvertFloatArrayToList( const TArray<float>& Value );
+	// Parse a JSON array string directly into an array of floats.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Parse Float Array"), Category = "JSON Library|Array")
+	static bool ParseFloatArray( const FString& Text, TArray<float>& Value );
+	// Stringify an array of floats directly as a JSON array string.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Stringify Float Array"), Category = "JSON Library|Array")
+	static FString StringifyFloatArray( const TArray<float>& Value );
+	// Parse CBOR data directly into an array of floats.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Parse CBOR Float Array"), Category = "JSON Library|Array")
+	static bool ParseCborFloatArray( const TArray<uint8>& Data, TArray<float>& Value );
+	// Encode an array of floats directly as CBOR data.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Encode CBOR Float Array"), Category = "JSON Library|Array")
+	static TArray<uint8> EncodeCborFloatArray( const TArray<float>& Value );
 	// Copy an array of integers to a JSON array.
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Copy Integer Array To List"), Category = "JSON Library|Array")
 	static FJsonLibraryList ConvertIntegerArrayToList( const TArray<int32>& Value );
@@ -432,6 +459,9 @@ public:
 	// Check if this value equals another value.
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Equals"), Category = "JSON Library|Value")
 	static bool JsonValue_Equals( UPARAM(ref) const FJsonLibraryValue& Target, const FJsonLibraryValue& Value );
+	// Get a hash of the contents of this value.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Hash"), Category = "JSON Library|Value")
+	static int32 JsonValue_GetHash( UPARAM(ref) const FJsonLibraryValue& Target );
 	// Check if this value is valid.
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Valid"), Category = "JSON Library|Value")
 	static bool JsonValue_IsValid( UPARAM(ref) const FJsonLibraryValue& Target );
@@ -453,6 +483,9 @@ public:
 	// Stringify this value.
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Stringify", AdvancedDisplay = "bCondensed"), Category = "JSON Library|Value")
 	static FString JsonValue_Stringify( UPARAM(ref) const FJsonLibraryValue& Target, bool bCondensed = true );
+	// Encode this value as CBOR data.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Encode CBOR", AdvancedDisplay = "bTypedArrays"), Category = "JSON Library|Value")
+	static TArray<uint8> JsonValue_EncodeCbor( UPARAM(ref) const FJsonLibraryValue& Target, bool bTypedArrays = true );
 
 
 	// Check if this object equals another object.
@@ -473,6 +506,13 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Remove Property"), Category = "JSON Library|Object")
 	static FJsonLibraryObject& JsonObject_RemoveKey( UPARAM(ref) FJsonLibraryObject& Target, const FString& Key );
 
+	// Start collecting notifications into one change set.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Begin Notify Batch"), Category = "JSON Library|Object")
+	static FJsonLibraryObject& JsonObject_BeginNotifyBatch( UPARAM(ref) FJsonLibraryObject& Target );
+	// Deliver the notifications collected since the matching begin.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "End Notify Batch"), Category = "JSON Library|Object")
+	static FJsonLibraryObject& JsonObject_EndNotifyBatch( UPARAM(ref) FJsonLibraryObject& Target );
+
 	// Add a JSON object to this object.
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Add"), Category = "JSON Library|Object")
 	static FJsonLibraryObject& JsonObject_Add( UPARAM(ref) FJsonLibraryObject& Target, const FJsonLibraryObject& Object );
@@ -649,6 +689,22 @@ public:
 	// Stringify this object.
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Stringify", AdvancedDisplay = "bCondensed"), Category = "JSON Library|Object")
 	static FString JsonObject_Stringify( UPARAM(ref) const FJsonLibraryObject& Target, bool bCondensed = true );
+	// Encode this object as CBOR data.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Encode CBOR", AdvancedDisplay = "bTypedArrays"), Category = "JSON Library|Object")
+	static TArray<uint8> JsonObject_EncodeCbor( UPARAM(ref) const FJsonLibraryObject& Target, bool bTypedArrays = true );
+
+	// Create a JSON patch that turns this object into another object.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Create Patch"), Category = "JSON Library|Object|Patch")
+	static FJsonLibraryList JsonObject_CreatePatch( UPARAM(ref) const FJsonLibraryObject& Target, const FJsonLibraryObject& Object );
+	// Apply a JSON patch to this object.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Apply Patch"), Category = "JSON Library|Object|Patch")
+	static bool JsonObject_ApplyPatch( UPARAM(ref) FJsonLibraryObject& Target, const FJsonLibraryList& Patch );
+	// Create a JSON merge patch that turns this object into another object.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Create Merge Patch"), Category = "JSON Library|Object|Patch")
+	static FJsonLibraryObject JsonObject_CreateMergePatch( UPARAM(ref) const FJsonLibraryObject& Target, const FJsonLibraryObject& Object );
+	// Apply a JSON merge patch to this object.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Apply Merge Patch"), Category = "JSON Library|Object|Patch")
+	static bool JsonObject_ApplyMergePatch( UPARAM(ref) FJsonLibraryObject& Target, const FJsonLibraryObject& Patch );
 
 
 	// Check if this list equals another list.
@@ -1069,6 +1125,13 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Find List"), Category = "JSON Library|List")
 	static int32 JsonList_FindList( UPARAM(ref) const FJsonLibraryList& Target, const FJsonLibraryList& Value, int32 Index = 0 );
 
+	// Keep a hash index of the items in this list; indexed finds and removes match values by contents.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Indexed"), Category = "JSON Library|List")
+	static FJsonLibraryList& JsonList_SetIndexed( UPARAM(ref) FJsonLibraryList& Target, bool bIndexed );
+	// Check if this list keeps a hash index.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Is Indexed"), Category = "JSON Library|List")
+	static bool JsonList_IsIndexed( UPARAM(ref) const FJsonLibraryList& Target );
+
 	// Check if this list is valid.
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Valid"), Category = "JSON Library|List")
 	static bool JsonList_IsValid( UPARAM(ref) const FJsonLibraryList& Target );
@@ -1079,6 +1142,151 @@ public:
 	// Stringify this list.
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Stringify", AdvancedDisplay = "bCondensed"), Category = "JSON Library|List")
 	static FString JsonList_Stringify( UPARAM(ref) const FJsonLibraryList& Target, bool bCondensed = true );
+	// Encode this list as CBOR data.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Encode CBOR", AdvancedDisplay = "bTypedArrays"), Category = "JSON Library|List")
+	static TArray<uint8> JsonList_EncodeCbor( UPARAM(ref) const FJsonLibraryList& Target, bool bTypedArrays = true );
+
+	// Check if this document is valid.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Valid"), Category = "JSON Library|Document")
+	static bool JsonDocument_IsValid( UPARAM(ref) const FJsonLibraryDocument& Target );
+	// Get the JSON type of this document.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Type"), Category = "JSON Library|Document")
+	static EJsonLibraryType JsonDocument_GetType( UPARAM(ref) const FJsonLibraryDocument& Target );
+
+	// Get the number of fields or items in this document.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Count"), Category = "JSON Library|Document")
+	static int32 JsonDocument_Count( UPARAM(ref) const FJsonLibraryDocument& Target );
+	// Check if this document has a field.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Has Key"), Category = "JSON Library|Document")
+	static bool JsonDocument_HasKey( UPARAM(ref) const FJsonLibraryDocument& Target, const FString& Key );
+	// Get the keys of this document.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Keys"), Category = "JSON Library|Document")
+	static TArray<FString> JsonDocument_GetKeys( UPARAM(ref) const FJsonLibraryDocument& Target );
+
+	// Get a field of this document, without building it.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Field"), Category = "JSON Library|Document")
+	static FJsonLibraryDocument JsonDocument_GetField( UPARAM(ref) const FJsonLibraryDocument& Target, const FString& Key );
+	// Get an item of this document, without building it.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Item"), Category = "JSON Library|Document")
+	static FJsonLibraryDocument JsonDocument_GetItem( UPARAM(ref) const FJsonLibraryDocument& Target, int32 Index );
+
+	// Read this document as a boolean.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Boolean"), Category = "JSON Library|Document")
+	static bool JsonDocument_GetBoolean( UPARAM(ref) const FJsonLibraryDocument& Target );
+	// Read this document as a float.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Float"), Category = "JSON Library|Document")
+	static float JsonDocument_GetFloat( UPARAM(ref) const FJsonLibraryDocument& Target );
+	// Read this document as an integer.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Integer"), Category = "JSON Library|Document")
+	static int32 JsonDocument_GetInteger( UPARAM(ref) const FJsonLibraryDocument& Target );
+	// Read this document as a string.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get String"), Category = "JSON Library|Document")
+	static FString JsonDocument_GetString( UPARAM(ref) const FJsonLibraryDocument& Target );
+
+	// Build this document as a JSON value.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Value"), Category = "JSON Library|Document")
+	static FJsonLibraryValue JsonDocument_GetValue( UPARAM(ref) const FJsonLibraryDocument& Target );
+	// Build this document as a JSON object.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Object"), Category = "JSON Library|Document")
+	static FJsonLibraryObject JsonDocument_GetObject( UPARAM(ref) const FJsonLibraryDocument& Target );
+	// Build this document as a JSON array.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get List"), Category = "JSON Library|Document")
+	static FJsonLibraryList JsonDocument_GetList( UPARAM(ref) const FJsonLibraryDocument& Target );
+
+	// Get the JSON text of this document.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Stringify"), Category = "JSON Library|Document")
+	static FString JsonDocument_Stringify( UPARAM(ref) const FJsonLibraryDocument& Target );
+
+	// Freeze a copy of a JSON value; the result can be read from any thread.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Freeze"), Category = "JSON Library|Frozen")
+	static FJsonLibraryFrozen JsonFrozen_Freeze( const FJsonLibraryValue& Value );
+	// Get a mutable copy of this frozen value.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Thaw"), Category = "JSON Library|Frozen")
+	static FJsonLibraryValue JsonFrozen_Thaw( UPARAM(ref) const FJsonLibraryFrozen& Target );
+	// Check if this frozen value is valid.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Valid"), Category = "JSON Library|Frozen")
+	static bool JsonFrozen_IsValid( UPARAM(ref) const FJsonLibraryFrozen& Target );
+	// Get the JSON type of this frozen value.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Type"), Category = "JSON Library|Frozen")
+	static EJsonLibraryType JsonFrozen_GetType( UPARAM(ref) const FJsonLibraryFrozen& Target );
+
+	// Get the number of fields or items in this frozen value.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Count"), Category = "JSON Library|Frozen")
+	static int32 JsonFrozen_Count( UPARAM(ref) const FJsonLibraryFrozen& Target );
+	// Check if this frozen value has a field.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Has Key"), Category = "JSON Library|Frozen")
+	static bool JsonFrozen_HasKey( UPARAM(ref) const FJsonLibraryFrozen& Target, const FString& Key );
+	// Get the keys of this frozen value.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Keys"), Category = "JSON Library|Frozen")
+	static TArray<FString> JsonFrozen_GetKeys( UPARAM(ref) const FJsonLibraryFrozen& Target );
+
+	// Get a field of this frozen value.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Field"), Category = "JSON Library|Frozen")
+	static FJsonLibraryFrozen JsonFrozen_GetField( UPARAM(ref) const FJsonLibraryFrozen& Target, const FString& Key );
+	// Get an item of this frozen value.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Item"), Category = "JSON Library|Frozen")
+	static FJsonLibraryFrozen JsonFrozen_GetItem( UPARAM(ref) const FJsonLibraryFrozen& Target, int32 Index );
+
+	// Convert this frozen value to a boolean.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Boolean"), Category = "JSON Library|Frozen")
+	static bool JsonFrozen_GetBoolean( UPARAM(ref) const FJsonLibraryFrozen& Target );
+	// Convert this frozen value to a float.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Float"), Category = "JSON Library|Frozen")
+	static float JsonFrozen_GetFloat( UPARAM(ref) const FJsonLibraryFrozen& Target );
+	// Convert this frozen value to an integer.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Integer"), Category = "JSON Library|Frozen")
+	static int32 JsonFrozen_GetInteger( UPARAM(ref) const FJsonLibraryFrozen& Target );
+	// Convert this frozen value to a string.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get String"), Category = "JSON Library|Frozen")
+	static FString JsonFrozen_GetString( UPARAM(ref) const FJsonLibraryFrozen& Target );
+
+	// Stringify this frozen value.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Stringify", AdvancedDisplay = "bCondensed"), Category = "JSON Library|Frozen")
+	static FString JsonFrozen_Stringify( UPARAM(ref) const FJsonLibraryFrozen& Target, bool bCondensed = true );
+
+	// Compile a JSON schema.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Compile Schema"), Category = "JSON Library|Schema")
+	static FJsonLibrarySchema JsonSchema_Compile( const FString& Schema );
+	// Check if this schema compiled.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Valid"), Category = "JSON Library|Schema")
+	static bool JsonSchema_IsValid( UPARAM(ref) const FJsonLibrarySchema& Target );
+
+	// Validate a JSON string without building any values.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Validate"), Category = "JSON Library|Schema")
+	static bool JsonSchema_Validate( UPARAM(ref) const FJsonLibrarySchema& Target, const FString& Text, FString& Error );
+	// Validate a JSON value.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Validate Value"), Category = "JSON Library|Schema")
+	static bool JsonSchema_ValidateValue( UPARAM(ref) const FJsonLibrarySchema& Target, const FJsonLibraryValue& Value, FString& Error );
+
+	// Compile a JSON pointer ("/items/0/id") or a JSONPath ("$.items[*].id").
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Compile Query"), Category = "JSON Library|Query")
+	static FJsonLibraryQuery JsonQuery_Compile( const FString& Query );
+	// Check if this query compiled.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Valid"), Category = "JSON Library|Query")
+	static bool JsonQuery_IsValid( UPARAM(ref) const FJsonLibraryQuery& Target );
+
+	// Get the first value matched in a JSON value.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Find"), Category = "JSON Library|Query")
+	static FJsonLibraryValue JsonQuery_Find( UPARAM(ref) const FJsonLibraryQuery& Target, const FJsonLibraryValue& Value );
+	// Get all values matched in a JSON value.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Find All"), Category = "JSON Library|Query")
+	static TArray<FJsonLibraryValue> JsonQuery_FindAll( UPARAM(ref) const FJsonLibraryQuery& Target, const FJsonLibraryValue& Value );
+
+	// Get the first value matched in each item of a list.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Extract Array"), Category = "JSON Library|Query")
+	static TArray<FJsonLibraryValue> JsonQuery_ExtractArray( UPARAM(ref) const FJsonLibraryQuery& Target, const FJsonLibraryList& List );
+	// Get the first value matched in each item of a list as a boolean.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Extract Boolean Array"), Category = "JSON Library|Query")
+	static TArray<bool> JsonQuery_ExtractBooleanArray( UPARAM(ref) const FJsonLibraryQuery& Target, const FJsonLibraryList& List );
+	// Get the first value matched in each item of a list as a float.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Extract Float Array"), Category = "JSON Library|Query")
+	static TArray<float> JsonQuery_ExtractFloatArray( UPARAM(ref) const FJsonLibraryQuery& Target, const FJsonLibraryList& List );
+	// Get the first value matched in each item of a list as an integer.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Extract Integer Array"), Category = "JSON Library|Query")
+	static TArray<int32> JsonQuery_ExtractIntegerArray( UPARAM(ref) const FJsonLibraryQuery& Target, const FJsonLibraryList& List );
+	// Get the first value matched in each item of a list as a string.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Extract String Array"), Category = "JSON Library|Query")
+	static TArray<FString> JsonQuery_ExtractStringArray( UPARAM(ref) const FJsonLibraryQuery& Target, const FJsonLibraryList& List );
 
 public:
 
@@ -0,0 +1,83 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "UObject/Object.h"
+#include "JsonLibraryValue.h"
+#include "JsonLibraryLines.generated.h"
+
+struct FJsonLibraryLinesFile;
+struct FJsonLibraryLinesStream;
+
+// Appends JSON values to a file as JSON lines (NDJSON), writing the file on a worker thread.
+UCLASS(BlueprintType)
+class JSONLIBRARY_API UJsonLibraryLinesWriter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	// Open a JSON lines file for writing.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Open JSON Lines Writer", AdvancedDisplay = "bAppend"), Category = "JSON Library|Lines")
+	static UJsonLibraryLinesWriter* OpenWriter( const FString& Filename, bool bAppend = true );
+
+	// Check if this writer is open.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Is Open"), Category = "JSON Library|Lines")
+	bool IsOpen() const;
+
+	// Write a JSON value as one line.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Write"), Category = "JSON Library|Lines")
+	bool Write( const FJsonLibraryValue& Value );
+	// Hand the buffered lines to the file without waiting for them to be written.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Flush"), Category = "JSON Library|Lines")
+	void Flush();
+	// Write the buffered lines and close the file.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Close"), Category = "JSON Library|Lines")
+	void Close();
+
+	virtual void BeginDestroy() override;
+
+private:
+
+	TSharedPtr<FJsonLibraryLinesFile, ESPMode::ThreadSafe> File;
+	TArray<uint8> Buffer;
+	TFuture<void> Pending;
+};
+
+// Reads JSON values from a JSON lines (NDJSON) file one line at a time.
+UCLASS(BlueprintType)
+class JSONLIBRARY_API UJsonLibraryLinesReader : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	// Open a JSON lines file, or the chunk of it that starts at an offset, for reading.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Open JSON Lines Reader", AdvancedDisplay = "Offset,Size"), Category = "JSON Library|Lines")
+	static UJsonLibraryLinesReader* OpenReader( const FString& Filename, int64 Offset = 0, int64 Size = -1 );
+
+	// Split a JSON lines file into chunks that start on line boundaries; chunk N spans offsets N to N + 1.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Split JSON Lines File"), Category = "JSON Library|Lines")
+	static TArray<int64> SplitFile( const FString& Filename, int32 Count );
+	// Parse every line of a JSON lines file, spreading the chunks across worker threads.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Parse JSON Lines File"), Category = "JSON Library|Lines")
+	static TArray<FJsonLibraryValue> ParseFile( const FString& Filename );
+
+	// Check if this reader is open.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Is Open"), Category = "JSON Library|Lines")
+	bool IsOpen() const;
+
+	// Read the next line as a JSON value; blank lines are skipped.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Read"), Category = "JSON Library|Lines")
+	bool Read( FJsonLibraryValue& Value );
+	// Read the next line as text.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Read Line"), Category = "JSON Library|Lines")
+	bool ReadLine( FString& Line );
+	// Close the file.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Close"), Category = "JSON Library|Lines")
+	void Close();
+
+private:
+
+	TSharedPtr<FJsonLibraryLinesStream> Stream;
+};
@@ -10,6 +10,7 @@
 #include "JsonLibraryList.generated.h"
 
 typedef struct FJsonLibraryObject FJsonLibraryObject;
+struct FJsonLibraryIndex;
 
 DECLARE_DYNAMIC_DELEGATE_FourParams( FJsonLibraryListNotify, const FJsonLibraryValue&, List, EJsonLibraryNotifyAction, Action, int32, Index, const FJsonLibraryValue&, Value );
 
@@ -18,6 +19,7 @@ struct JSONLIBRARY_API FJsonLibraryList
 {
 	friend struct FJsonLibraryObject;
 	friend struct FJsonLibraryValue;
+	friend struct FJsonLibraryQuery;
 
 	GENERATED_USTRUCT_BODY()
 
@@ -361,6 +363,12 @@ public:
 	// Find a JSON array in this list.
 	int32 FindList( const FJsonLibraryList& Value, int32 Index = 0 ) const;
 
+	// Keep a hash index of the items in this list; indexed finds and removes match values by contents, with strings compared case-sensitively.
+	// Edits made through JSON library handles are picked up; edits made straight to the engine JSON values are not.
+	void SetIndexed( bool bIndexed );
+	// Check if this list keeps a hash index.
+	bool IsIndexed() const;
+
 protected:
 	
 	TSharedPtr<FJsonValueArray> JsonArray;
@@ -370,6 +378,7 @@ protected:
 
 	bool TryParse( const FString& Text, bool bStripComments = false, bool bStripTrailingCommas = false );
 	bool TryStringify( FString& Text, bool bCondensed = true ) const;
+	bool TryParseCbor( const TArray<uint8>& Data );
 
 private:
 
@@ -386,6 +395,15 @@ private:
 	void NotifyParse();
 	void NotifyRemove( int32 Index );
 
+	TSharedPtr<FJsonLibraryIndex> JsonIndex;
+
+	void IndexInsert( int32 Index, int32 Count = 1 );
+	void IndexSet( int32 Index );
+	void IndexRemove( int32 Index );
+	void IndexReset();
+	int32 IndexFind( const TSharedPtr<FJsonValue>& Value, int32 Index ) const;
+	bool IndexRemoveAll( const TSharedPtr<FJsonValue>& Value );
+
 public:
 
 	// Check if this list is valid.
@@ -404,9 +422,81 @@ public:
 	// Stringify this list as a JSON string.
 	FString Stringify( bool bCondensed = true ) const;
 
+	// Parse a JSON string directly into an array of floats.
+	static bool ParseFloatArray( const FString& Text, TArray<float>& Array );
+	// Parse a JSON string directly into an array of numbers.
+	static bool ParseNumberArray( const FString& Text, TArray<double>& Array );
+
+	// Stringify an array of floats directly as a JSON string.
+	static FString StringifyFloatArray( const TArray<float>& Array );
+	// Stringify an array of numbers directly as a JSON string.
+	static FString StringifyNumberArray( const TArray<double>& Array );
+
+	// Parse CBOR data.
+	static FJsonLibraryList ParseCbor( const TArray<uint8>& Data );
+	// Parse CBOR data.
+	static FJsonLibraryList ParseCbor( const TArray<uint8>& Data, const FJsonLibraryListNotify& Notify );
+	// Encode this list as CBOR data.
+	TArray<uint8> EncodeCbor( bool bTypedArrays = true ) const;
+
+	// Parse CBOR data directly into an array of floats.
+	static bool ParseCborFloatArray( const TArray<uint8>& Data, TArray<float>& Array );
+	// Parse CBOR data directly into an array of numbers.
+	static bool ParseCborNumberArray( const TArray<uint8>& Data, TArray<double>& Array );
+
+	// Encode an array of floats directly as a CBOR typed array.
+	static TArray<uint8> EncodeCborFloatArray( const TArray<float>& Array );
+	// Encode an array of numbers directly as a CBOR typed array.
+	static TArray<uint8> EncodeCborNumberArray( const TArray<double>& Array );
+
 	// Copy this list to an array of JSON values.
 	TArray<FJsonLibraryValue> ToArray() const;
 
+	// Walks the items of a list in place, wrapping each item as it is reached.
+	struct FConstIterator
+	{
+		FConstIterator( const TArray<TSharedPtr<FJsonValue>>* InArray, int32 InIndex )
+			: Array( InArray )
+			, Index( InIndex )
+		{
+		}
+
+		FJsonLibraryValue operator*() const
+		{
+			return FJsonLibraryValue( ( *Array )[ Index ] );
+		}
+
+		FConstIterator& operator++()
+		{
+			Index++;
+			return *this;
+		}
+
+		explicit operator bool() const
+		{
+			return Array && Array->IsValidIndex( Index );
+		}
+
+		bool operator!=( const FConstIterator& Other ) const
+		{
+			return Index != Other.Index;
+		}
+
+		int32 GetIndex() const
+		{
+			return Index;
+		}
+
+	private:
+
+		const TArray<TSharedPtr<FJsonValue>>* Array;
+		int32 Index;
+	};
+
+	// Iterate the items of this list without copying them; the list must not change while iterating.
+	FConstIterator begin() const;
+	FConstIterator end() const;
+
 	// Copy this list to an array of booleans.
 	TArray<bool> ToBooleanArray() const;
 	// Copy this list to an array of floats.
@@ -0,0 +1,50 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "JsonLibraryValue.h"
+#include "JsonLibraryLoadFile.generated.h"
+
+struct FJsonLibraryLoadFileState;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams( FJsonLibraryLoadFileEvent, const FJsonLibraryValue&, Value, float, Progress );
+
+UCLASS()
+class JSONLIBRARY_API UJsonLibraryLoadFile : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+
+	// Load and parse a JSON file on a worker thread.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Load JSON File", BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "JSON Library")
+	static UJsonLibraryLoadFile* LoadFile( UObject* WorldContextObject, const FString& Filename );
+
+	// Called as the file is read, with the progress from 0 to 1.
+	UPROPERTY(BlueprintAssignable)
+	FJsonLibraryLoadFileEvent OnProgress;
+	// Called with the parsed value once the file is loaded.
+	UPROPERTY(BlueprintAssignable)
+	FJsonLibraryLoadFileEvent OnComplete;
+	// Called if the file could not be read or parsed.
+	UPROPERTY(BlueprintAssignable)
+	FJsonLibraryLoadFileEvent OnFailed;
+
+	// Cancel loading this file; no further events are called.
+	UFUNCTION(BlueprintCallable, Category = "JSON Library")
+	void Cancel();
+	// Check if this file is still loading.
+	UFUNCTION(BlueprintPure, Category = "JSON Library")
+	bool IsLoading() const;
+
+	virtual void Activate() override;
+
+private:
+
+	FString Filename;
+	TSharedPtr<FJsonLibraryLoadFileState, ESPMode::ThreadSafe> State;
+	bool bCancelled = false;
+
+	void HandleProgress( float Progress );
+	void HandleComplete( const TSharedPtr<FJsonValue>& Value );
+};
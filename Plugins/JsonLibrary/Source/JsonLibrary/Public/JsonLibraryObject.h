@@ -5,6 +5,7 @@
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonTypes.h"
+#include "Misc/Optional.h"
 #include "UObject/StructOnScope.h"
 #include "JsonLibraryEnums.h"
 #include "JsonLibraryValue.h"
@@ -14,6 +15,24 @@ typedef struct FJsonLibraryList FJsonLibraryList;
 
 DECLARE_DYNAMIC_DELEGATE_FourParams( FJsonLibraryObjectNotify, const FJsonLibraryValue&, Object, EJsonLibraryNotifyAction, Action, const FString&, Key, const FJsonLibraryValue&, Value );
 
+USTRUCT(BlueprintType, meta = (DisplayName = "JSON Object Change"))
+struct JSONLIBRARY_API FJsonLibraryObjectChange
+{
+	GENERATED_USTRUCT_BODY()
+
+	// How the property changed.
+	UPROPERTY(BlueprintReadOnly, Category = "JSON Library|Object")
+	EJsonLibraryNotifyAction Action = EJsonLibraryNotifyAction::None;
+	// The name of the property.
+	UPROPERTY(BlueprintReadOnly, Category = "JSON Library|Object")
+	FString Key;
+	// The new value of the property, or the removed value.
+	UPROPERTY(BlueprintReadOnly, Category = "JSON Library|Object")
+	FJsonLibraryValue Value;
+};
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams( FJsonLibraryObjectBatchNotify, const FJsonLibraryValue&, Object, const TArray<FJsonLibraryObjectChange>&, Changes );
+
 USTRUCT(BlueprintType, meta = (DisplayName = "JSON Object"))
 struct JSONLIBRARY_API FJsonLibraryObject
 {
@@ -42,7 +61,9 @@ public:
 	}
 
 	FJsonLibraryObject();
+	FJsonLibraryObject( const FJsonLibraryObject& Object );
 	FJsonLibraryObject( const FJsonLibraryObjectNotify& Notify );
+	FJsonLibraryObject( const FJsonLibraryObjectBatchNotify& Notify );
 
 	FJsonLibraryObject( const FLinearColor& Value );
 
@@ -80,6 +101,13 @@ public:
 	// Remove a property from this object.
 	void RemoveKey( const FString& Key );
 	
+	// Start collecting notifications into one change set.
+	void BeginNotifyBatch();
+	// Deliver the notifications collected since the matching begin.
+	void EndNotifyBatch();
+	// Check if notifications are being collected into a batch.
+	bool IsNotifyBatching() const;
+
 	// Add a JSON object to this object.
 	void Add( const FJsonLibraryObject& Object );
 
@@ -205,14 +233,22 @@ protected:
 
 	bool TryParse( const FString& Text, bool bStripComments = false, bool bStripTrailingCommas = false );
 	bool TryStringify( FString& Text, bool bCondensed = true ) const;
+	bool TryParseCbor( const TArray<uint8>& Data );
 
 private:
 
 	FJsonLibraryObjectNotify OnNotify;
+	FJsonLibraryObjectBatchNotify OnBatchNotify;
 
 	bool bNotifyHasKey;
 	TSharedPtr<FJsonValue> NotifyValue;
 
+	int32 NotifyBatchDepth = 0;
+	TArray<FJsonLibraryObjectChange> NotifyChanges;
+	TMap<FString, int32> NotifyChangeIndex;
+
+	bool IsNotifyBound() const;
+	void NotifyExecute( EJsonLibraryNotifyAction Action, const FString& Key, const TSharedPtr<FJsonValue>& Value );
 	void NotifyAddOrChange( const FString& Key, const FJsonLibraryValue& Value );
 	bool NotifyCheck();
 	bool NotifyCheck( const FString& Key );
@@ -248,6 +284,23 @@ public:
 	// Stringify this object as a JSON string.
 	FString Stringify( bool bCondensed = true ) const;
 
+	// Parse CBOR data.
+	static FJsonLibraryObject ParseCbor( const TArray<uint8>& Data );
+	// Parse CBOR data.
+	static FJsonLibraryObject ParseCbor( const TArray<uint8>& Data, const FJsonLibraryObjectNotify& Notify );
+	// Encode this object as CBOR data.
+	TArray<uint8> EncodeCbor( bool bTypedArrays = true ) const;
+
+	// Create a JSON patch (RFC 6902) that turns this object into another.
+	FJsonLibraryList CreatePatch( const FJsonLibraryObject& Target ) const;
+	// Apply a JSON patch (RFC 6902) to this object.
+	bool ApplyPatch( const FJsonLibraryList& Patch );
+
+	// Create a JSON merge patch (RFC 7396) that turns this object into another.
+	FJsonLibraryObject CreateMergePatch( const FJsonLibraryObject& Target ) const;
+	// Apply a JSON merge patch (RFC 7396) to this object.
+	bool ApplyMergePatch( const FJsonLibraryObject& Patch );
+
 protected:
 	
 	bool ToStruct( const UStruct* StructType, void* StructPtr ) const;
@@ -281,6 +334,56 @@ public:
 	// Copy a JSON object to a map of JSON values.
 	TMap<FString, FJsonLibraryValue> ToMap() const;
 
+	// Walks the properties of an object in place, wrapping each value as it is reached.
+	struct FConstIterator
+	{
+		explicit FConstIterator( const TMap<FString, TSharedPtr<FJsonValue>>* InMap )
+		{
+			if ( InMap )
+				Property.Emplace( InMap->CreateConstIterator() );
+		}
+
+		const FString& Key() const
+		{
+			return Property->Key();
+		}
+
+		FJsonLibraryValue Value() const
+		{
+			return FJsonLibraryValue( Property->Value() );
+		}
+
+		const FConstIterator& operator*() const
+		{
+			return *this;
+		}
+
+		FConstIterator& operator++()
+		{
+			++Property.GetValue();
+			return *this;
+		}
+
+		explicit operator bool() const
+		{
+			return Property.IsSet() && (bool)Property.GetValue();
+		}
+
+		// Only the end of the properties is checked, as with the engine's ranged-for iterators.
+		bool operator!=( const FConstIterator& Other ) const
+		{
+			return (bool)*this;
+		}
+
+	private:
+
+		TOptional<TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator> Property;
+	};
+
+	// Iterate the properties of this object without copying them; the object must not change while iterating.
+	FConstIterator begin() const;
+	FConstIterator end() const;
+
 	// Copy a JSON object to a map of booleans.
 	TMap<FString, bool> ToBooleanMap() const;
 	// Copy a JSON object to a map of floats.
@@ -309,6 +412,9 @@ public:
 	// Copy a JSON object to a map of vectors.
 	TMap<FString, FVector> ToVectorMap() const;
 
+	// Copies share the JSON object and notify delegates, but not an open notify batch.
+	FJsonLibraryObject& operator=( const FJsonLibraryObject& Object );
+
 	bool operator==( const FJsonLibraryObject& Object ) const;
 	bool operator!=( const FJsonLibraryObject& Object ) const;
 
@@ -0,0 +1,64 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+#include "JsonLibraryValue.h"
+#include "JsonLibraryObject.h"
+#include "JsonLibraryList.h"
+#include "JsonLibraryQuery.generated.h"
+
+struct FJsonLibraryQueryStep;
+
+USTRUCT(BlueprintType, meta = (DisplayName = "JSON Query"))
+struct JSONLIBRARY_API FJsonLibraryQuery
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+
+	FJsonLibraryQuery();
+
+	// Compile a JSON pointer ("/items/0/id") or a JSONPath ("$.items[*].id").
+	static FJsonLibraryQuery Compile( const FString& Query );
+
+	// Check if this query compiled.
+	bool IsValid() const;
+	// Check if this query can match more than one value.
+	bool IsMultiple() const;
+	// Get the text this query was compiled from.
+	FString GetText() const;
+
+	// Get the first value matched in a JSON value.
+	FJsonLibraryValue Find( const FJsonLibraryValue& Value ) const;
+	// Get all values matched in a JSON value.
+	TArray<FJsonLibraryValue> FindAll( const FJsonLibraryValue& Value ) const;
+
+	// Get the first value matched in each item of a list.
+	TArray<FJsonLibraryValue> ExtractArray( const FJsonLibraryList& List ) const;
+
+	// Get the first value matched in each item of a list as a boolean, or false.
+	TArray<bool> ExtractBooleanArray( const FJsonLibraryList& List ) const;
+	// Get the first value matched in each item of a list as a float, or zero.
+	TArray<float> ExtractFloatArray( const FJsonLibraryList& List ) const;
+	// Get the first value matched in each item of a list as an integer, or zero.
+	TArray<int32> ExtractIntegerArray( const FJsonLibraryList& List ) const;
+	// Get the first value matched in each item of a list as a number, or zero.
+	TArray<double> ExtractNumberArray( const FJsonLibraryList& List ) const;
+	// Get the first value matched in each item of a list as a string, or empty.
+	TArray<FString> ExtractStringArray( const FJsonLibraryList& List ) const;
+
+private:
+
+	FString Text;
+	TSharedPtr<const TArray<FJsonLibraryQueryStep>> Steps;
+	bool bMultiple;
+
+	bool TryCompilePointer( const FString& Pointer, TArray<FJsonLibraryQueryStep>& OutSteps ) const;
+	bool TryCompilePath( const FString& Path, TArray<FJsonLibraryQueryStep>& OutSteps ) const;
+
+	const TSharedPtr<FJsonValue>* FindFirst( const TSharedPtr<FJsonValue>& Value, int32 Step = 0 ) const;
+	void FindAll( const TSharedPtr<FJsonValue>& Value, int32 Step, TArray<FJsonLibraryValue>& Values ) const;
+
+	template<typename ItemType, typename ConvertType>
+	TArray<ItemType> Extract( const FJsonLibraryList& List, ConvertType Convert ) const;
+};
@@ -0,0 +1,56 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+#include "JsonLibraryValue.h"
+#include "JsonLibrarySchema.generated.h"
+
+struct FJsonLibrarySchemaNode;
+struct FJsonLibraryScanner;
+
+USTRUCT(BlueprintType, meta = (DisplayName = "JSON Schema"))
+struct JSONLIBRARY_API FJsonLibrarySchema
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+
+	FJsonLibrarySchema();
+
+	// Compile a JSON schema (type, enum, const, properties, required, additionalProperties, items and numeric, length and count bounds).
+	// Any other keyword, apart from annotations such as title and description, fails to compile.
+	static FJsonLibrarySchema Compile( const FJsonLibraryValue& Schema );
+	// Compile a JSON schema string.
+	static FJsonLibrarySchema Compile( const FString& Schema );
+
+	// Check if this schema compiled.
+	bool IsValid() const;
+
+	// Validate a JSON string in one pass, without building any values.
+	bool Validate( const FString& Text ) const;
+	// Validate a JSON string in one pass, and describe where it first fails.
+	bool Validate( const FString& Text, FString& Error ) const;
+	// Validate a JSON value.
+	bool ValidateValue( const FJsonLibraryValue& Value ) const;
+	// Validate a JSON value, and describe where it first fails.
+	bool ValidateValue( const FJsonLibraryValue& Value, FString& Error ) const;
+
+	// Validate a JSON string and read it straight into structure memory.
+	bool Decode( const FString& Text, const UStruct* StructType, void* StructPtr, FString* Error = nullptr ) const;
+
+	// Validate a JSON string and read it straight into a structure.
+	template<typename StructType>
+	bool Decode( const FString& Text, StructType& Struct, FString* Error = nullptr ) const
+	{
+		return Decode( Text, StructType::StaticStruct(), &Struct, Error );
+	}
+
+private:
+
+	TSharedPtr<const TArray<FJsonLibrarySchemaNode>> Nodes;
+
+	static int32 CompileNode( const TSharedPtr<FJsonValue>& Schema, TArray<FJsonLibrarySchemaNode>& OutNodes );
+
+	bool ValidateText( const FJsonLibraryScanner& Scanner, int32& Pos, int32 Node, int32 Depth, FString* Error ) const;
+	bool ValidateTree( const TSharedPtr<FJsonValue>& Value, int32 Node, FString* Error ) const;
+};
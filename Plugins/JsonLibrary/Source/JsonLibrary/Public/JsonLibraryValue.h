@@ -1,5 +1,6 @@
 // Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
 #pragma once
+#include "Containers/StringView.h"
 #include "Dom/JsonValue.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonReader.h"
@@ -16,6 +17,12 @@ struct JSONLIBRARY_API FJsonLibraryValue
 {
 	friend struct FJsonLibraryList;
 	friend struct FJsonLibraryObject;
+	friend struct FJsonLibraryQuery;
+	friend struct FJsonLibraryDocument;
+	friend struct FJsonLibraryFrozen;
+	friend struct FJsonLibrarySchema;
+
+	friend class UJsonLibraryLoadFile;
 
 	GENERATED_USTRUCT_BODY()
 
@@ -61,6 +68,8 @@ public:
 
 	// Check if this value equals another JSON value.
 	bool Equals( const FJsonLibraryValue& Value, bool bStrict = false ) const;
+	// Get a hash of the contents of this value.
+	uint32 GetHash() const;
 
 	// Convert this value to a boolean.
 	bool GetBoolean() const;
@@ -72,6 +81,8 @@ public:
 	double GetNumber() const;
 	// Convert this value to a string.
 	FString GetString() const;
+	// View the text of a plain string value in place; empty for any other value, so use GetString for those.
+	FStringView GetStringView() const;
 
 	// Convert this value to a date/time.
 	FDateTime GetDateTime() const;
@@ -118,6 +129,7 @@ protected:
 
 	bool TryParse( const FString& Text, bool bStripComments = false, bool bStripTrailingCommas = false );
 	bool TryStringify( FString& Text, bool bCondensed = true ) const;
+	bool TryParseCbor( const TArray<uint8>& Data );
 
 public:
 
@@ -149,6 +161,11 @@ public:
 	// Stringify this value as a JSON string.
 	FString Stringify( bool bCondensed = true ) const;
 
+	// Parse CBOR data.
+	static FJsonLibraryValue ParseCbor( const TArray<uint8>& Data );
+	// Encode this value as CBOR data.
+	TArray<uint8> EncodeCbor( bool bTypedArrays = true ) const;
+
 	// Copy this value to an array of JSON values.
 	TArray<FJsonLibraryValue> ToArray() const;
 	// Copy this value to a map of JSON values.
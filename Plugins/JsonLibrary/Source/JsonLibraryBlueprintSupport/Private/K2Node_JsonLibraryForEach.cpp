@@ -0,0 +1,237 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#include "K2Node_JsonLibraryForEach.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_ExecutionSequence.h"
+#include "K2Node_IfThenElse.h"
+#include "KismetCompiler.h"
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "JsonLibraryObject.h"
+#include "JsonLibraryList.h"
+#include "JsonLibraryBlueprintHelpers.h"
+
+#define LOCTEXT_NAMESPACE "K2Node_JsonLibraryForEach"
+
+struct UK2Node_JsonLibraryForEachHelper
+{
+	static FName TargetPinName;
+	static FName LoopBodyPinName;
+	static FName ValuePinName;
+	static FName IndexPinName;
+	static FName KeyPinName;
+};
+
+FName UK2Node_JsonLibraryForEachHelper::TargetPinName( TEXT( "Target" ) );
+FName UK2Node_JsonLibraryForEachHelper::LoopBodyPinName( TEXT( "LoopBody" ) );
+FName UK2Node_JsonLibraryForEachHelper::ValuePinName( TEXT( "Value" ) );
+FName UK2Node_JsonLibraryForEachHelper::IndexPinName( TEXT( "Index" ) );
+FName UK2Node_JsonLibraryForEachHelper::KeyPinName( TEXT( "Key" ) );
+
+UK2Node_JsonLibraryForEach::UK2Node_JsonLibraryForEach( const FObjectInitializer& ObjectInitializer )
+	: Super( ObjectInitializer )
+{
+}
+
+void UK2Node_JsonLibraryForEach::AllocateDefaultPins()
+{
+	CreatePin( EGPD_Input, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Execute );
+
+	UEdGraphPin* TargetPin = CreatePin( EGPD_Input, UEdGraphSchema_K2::PC_Struct, GetTargetType(), UK2Node_JsonLibraryForEachHelper::TargetPinName );
+	SetPinToolTip( *TargetPin, LOCTEXT( "TargetPinDescription", "The JSON value to loop over." ) );
+
+	UEdGraphPin* LoopBodyPin = CreatePin( EGPD_Output, UEdGraphSchema_K2::PC_Exec, UK2Node_JsonLibraryForEachHelper::LoopBodyPinName );
+	LoopBodyPin->PinFriendlyName = LOCTEXT( "JsonLibraryForEach Loop Body", "Loop Body" );
+
+	UEdGraphPin* ValuePin = CreatePin( EGPD_Output, UEdGraphSchema_K2::PC_Struct, TBaseStructure<FJsonLibraryValue>::Get(), UK2Node_JsonLibraryForEachHelper::ValuePinName );
+	SetPinToolTip( *ValuePin, LOCTEXT( "ValuePinDescription", "The current value." ) );
+
+	if ( HasKeyPin() )
+	{
+		UEdGraphPin* KeyPin = CreatePin( EGPD_Output, UEdGraphSchema_K2::PC_String, UK2Node_JsonLibraryForEachHelper::KeyPinName );
+		SetPinToolTip( *KeyPin, LOCTEXT( "KeyPinDescription", "The name of the current property." ) );
+	}
+
+	UEdGraphPin* IndexPin = CreatePin( EGPD_Output, UEdGraphSchema_K2::PC_Int, UK2Node_JsonLibraryForEachHelper::IndexPinName );
+	SetPinToolTip( *IndexPin, LOCTEXT( "IndexPinDescription", "The position of the current value." ) );
+
+	UEdGraphPin* CompletedPin = CreatePin( EGPD_Output, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Then );
+	CompletedPin->PinFriendlyName = LOCTEXT( "JsonLibraryForEach Completed", "Completed" );
+
+	Super::AllocateDefaultPins();
+}
+
+void UK2Node_JsonLibraryForEach::SetPinToolTip( UEdGraphPin& MutatablePin, const FText& PinDescription ) const
+{
+	MutatablePin.PinToolTip = UEdGraphSchema_K2::TypeToText( MutatablePin.PinType ).ToString();
+
+	UEdGraphSchema_K2 const* const K2Schema = Cast<const UEdGraphSchema_K2>( GetSchema() );
+	if ( K2Schema )
+	{
+		MutatablePin.PinToolTip += TEXT( " " );
+		MutatablePin.PinToolTip += K2Schema->GetPinDisplayName( &MutatablePin ).ToString();
+	}
+
+	MutatablePin.PinToolTip += FString( TEXT( "\n" ) ) + PinDescription.ToString();
+}
+
+void UK2Node_JsonLibraryForEach::GetMenuActions( FBlueprintActionDatabaseRegistrar& ActionRegistrar ) const
+{
+	UClass* ActionKey = GetClass();
+	if ( ActionRegistrar.IsOpenForRegistration( ActionKey ) )
+	{
+		UBlueprintNodeSpawner* NodeSpawner = UBlueprintNodeSpawner::Create( GetClass() );
+		check( NodeSpawner != nullptr );
+
+		ActionRegistrar.AddBlueprintAction( ActionKey, NodeSpawner );
+	}
+}
+
+FText UK2Node_JsonLibraryForEach::GetTooltipText() const
+{
+	return NodeTooltip;
+}
+
+UEdGraphPin* UK2Node_JsonLibraryForEach::GetTargetPin() const
+{
+	UEdGraphPin* Pin = FindPinChecked( UK2Node_JsonLibraryForEachHelper::TargetPinName );
+	check( Pin->Direction == EGPD_Input );
+	return Pin;
+}
+
+UEdGraphPin* UK2Node_JsonLibraryForEach::GetLoopBodyPin() const
+{
+	UEdGraphPin* Pin = FindPinChecked( UK2Node_JsonLibraryForEachHelper::LoopBodyPinName );
+	check( Pin->Direction == EGPD_Output );
+	return Pin;
+}
+
+UEdGraphPin* UK2Node_JsonLibraryForEach::GetCompletedPin() const
+{
+	UEdGraphPin* Pin = FindPinChecked( UEdGraphSchema_K2::PN_Then );
+	check( Pin->Direction == EGPD_Output );
+	return Pin;
+}
+
+UEdGraphPin* UK2Node_JsonLibraryForEach::GetValuePin() const
+{
+	UEdGraphPin* Pin = FindPinChecked( UK2Node_JsonLibraryForEachHelper::ValuePinName );
+	check( Pin->Direction == EGPD_Output );
+	return Pin;
+}
+
+UEdGraphPin* UK2Node_JsonLibraryForEach::GetIndexPin() const
+{
+	UEdGraphPin* Pin = FindPinChecked( UK2Node_JsonLibraryForEachHelper::IndexPinName );
+	check( Pin->Direction == EGPD_Output );
+	return Pin;
+}
+
+UEdGraphPin* UK2Node_JsonLibraryForEach::GetKeyPin() const
+{
+	return FindPin( UK2Node_JsonLibraryForEachHelper::KeyPinName );
+}
+
+void UK2Node_JsonLibraryForEach::ExpandNode( FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph )
+{
+	Super::ExpandNode( CompilerContext, SourceGraph );
+
+	// the iterator walks the value in place; each pass only wraps the current item
+	UK2Node_CallFunction* CallIterateFunction = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>( this, SourceGraph );
+	CallIterateFunction->FunctionReference.SetExternalMember( GetIterateFunctionName(), UJsonLibraryBlueprintHelpers::StaticClass() );
+	CallIterateFunction->AllocateDefaultPins();
+
+	CompilerContext.MovePinLinksToIntermediate( *GetExecPin(), *( CallIterateFunction->GetExecPin() ) );
+	CompilerContext.MovePinLinksToIntermediate( *GetTargetPin(), *( CallIterateFunction->FindPinChecked( TEXT( "Target" ) ) ) );
+
+	const FName IteratorNextFunctionName = GET_FUNCTION_NAME_CHECKED( UJsonLibraryBlueprintHelpers, IteratorNext );
+	UK2Node_CallFunction* CallNextFunction = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>( this, SourceGraph );
+	CallNextFunction->FunctionReference.SetExternalMember( IteratorNextFunctionName, UJsonLibraryBlueprintHelpers::StaticClass() );
+	CallNextFunction->AllocateDefaultPins();
+
+	CallIterateFunction->GetThenPin()->MakeLinkTo( CallNextFunction->GetExecPin() );
+	CallIterateFunction->GetReturnValuePin()->MakeLinkTo( CallNextFunction->FindPinChecked( TEXT( "Iterator" ) ) );
+
+	UK2Node_IfThenElse* BranchNode = CompilerContext.SpawnIntermediateNode<UK2Node_IfThenElse>( this, SourceGraph );
+	BranchNode->AllocateDefaultPins();
+
+	CallNextFunction->GetThenPin()->MakeLinkTo( BranchNode->GetExecPin() );
+	CallNextFunction->GetReturnValuePin()->MakeLinkTo( BranchNode->GetConditionPin() );
+
+	UK2Node_ExecutionSequence* SequenceNode = CompilerContext.SpawnIntermediateNode<UK2Node_ExecutionSequence>( this, SourceGraph );
+	SequenceNode->AllocateDefaultPins();
+
+	BranchNode->GetThenPin()->MakeLinkTo( SequenceNode->GetExecPin() );
+	SequenceNode->GetThenPinGivenIndex( 1 )->MakeLinkTo( CallNextFunction->GetExecPin() );
+
+	CompilerContext.MovePinLinksToIntermediate( *GetLoopBodyPin(), *( SequenceNode->GetThenPinGivenIndex( 0 ) ) );
+	CompilerContext.MovePinLinksToIntermediate( *GetCompletedPin(), *( BranchNode->GetElsePin() ) );
+
+	CompilerContext.MovePinLinksToIntermediate( *GetValuePin(), *( CallNextFunction->FindPinChecked( TEXT( "Value" ) ) ) );
+	CompilerContext.MovePinLinksToIntermediate( *GetIndexPin(), *( CallNextFunction->FindPinChecked( TEXT( "Index" ) ) ) );
+	if ( UEdGraphPin* KeyPin = GetKeyPin() )
+		CompilerContext.MovePinLinksToIntermediate( *KeyPin, *( CallNextFunction->FindPinChecked( TEXT( "Key" ) ) ) );
+
+	BreakAllNodeLinks();
+}
+
+FSlateIcon UK2Node_JsonLibraryForEach::GetIconAndTint( FLinearColor& OutColor ) const
+{
+	static FSlateIcon Icon( "EditorStyle", "GraphEditor.Macro.Loop_16x" );
+	return Icon;
+}
+
+UK2Node_JsonLibraryForEachItem::UK2Node_JsonLibraryForEachItem( const FObjectInitializer& ObjectInitializer )
+	: Super( ObjectInitializer )
+{
+	NodeTooltip = LOCTEXT( "ItemNodeTooltip", "Loops over each item of a JSON list without copying it." );
+}
+
+FText UK2Node_JsonLibraryForEachItem::GetNodeTitle( ENodeTitleType::Type TitleType ) const
+{
+	return LOCTEXT( "ItemListViewTitle", "For Each JSON Item" );
+}
+
+FText UK2Node_JsonLibraryForEachItem::GetMenuCategory() const
+{
+	return FText::FromString( TEXT( "JSON Library|List" ) );
+}
+
+UScriptStruct* UK2Node_JsonLibraryForEachItem::GetTargetType() const
+{
+	return TBaseStructure<FJsonLibraryList>::Get();
+}
+
+FName UK2Node_JsonLibraryForEachItem::GetIterateFunctionName() const
+{
+	return GET_FUNCTION_NAME_CHECKED( UJsonLibraryBlueprintHelpers, IterateList );
+}
+
+UK2Node_JsonLibraryForEachProperty::UK2Node_JsonLibraryForEachProperty( const FObjectInitializer& ObjectInitializer )
+	: Super( ObjectInitializer )
+{
+	NodeTooltip = LOCTEXT( "PropertyNodeTooltip", "Loops over each property of a JSON object without copying it." );
+}
+
+FText UK2Node_JsonLibraryForEachProperty::GetNodeTitle( ENodeTitleType::Type TitleType ) const
+{
+	return LOCTEXT( "PropertyListViewTitle", "For Each JSON Property" );
+}
+
+FText UK2Node_JsonLibraryForEachProperty::GetMenuCategory() const
+{
+	return FText::FromString( TEXT( "JSON Library|Object" ) );
+}
+
+UScriptStruct* UK2Node_JsonLibraryForEachProperty::GetTargetType() const
+{
+	return TBaseStructure<FJsonLibraryObject>::Get();
+}
+
+FName UK2Node_JsonLibraryForEachProperty::GetIterateFunctionName() const
+{
+	return GET_FUNCTION_NAME_CHECKED( UJsonLibraryBlueprintHelpers, IterateObject );
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,70 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Textures/SlateIcon.h"
+#include "K2Node.h"
+#include "K2Node_JsonLibraryForEach.generated.h"
+
+class FBlueprintActionDatabaseRegistrar;
+class UEdGraph;
+
+UCLASS(Abstract)
+class JSONLIBRARYBLUEPRINTSUPPORT_API UK2Node_JsonLibraryForEach : public UK2Node
+{
+	GENERATED_UCLASS_BODY()
+
+	virtual void AllocateDefaultPins() override;
+	virtual FText GetTooltipText() const override;
+	virtual void ExpandNode( class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph ) override;
+	virtual FSlateIcon GetIconAndTint( FLinearColor& OutColor ) const override;
+
+	virtual bool IsNodeSafeToIgnore() const override { return true; }
+	virtual void GetMenuActions( FBlueprintActionDatabaseRegistrar& ActionRegistrar ) const override;
+
+	UEdGraphPin* GetTargetPin() const;
+	UEdGraphPin* GetLoopBodyPin() const;
+	UEdGraphPin* GetCompletedPin() const;
+	UEdGraphPin* GetValuePin() const;
+	UEdGraphPin* GetIndexPin() const;
+	UEdGraphPin* GetKeyPin() const;
+
+protected:
+
+	virtual UScriptStruct* GetTargetType() const PURE_VIRTUAL( UK2Node_JsonLibraryForEach::GetTargetType, return nullptr; );
+	virtual FName GetIterateFunctionName() const PURE_VIRTUAL( UK2Node_JsonLibraryForEach::GetIterateFunctionName, return NAME_None; );
+	virtual bool HasKeyPin() const { return false; }
+
+	void SetPinToolTip( UEdGraphPin& MutatablePin, const FText& PinDescription ) const;
+
+	FText NodeTooltip;
+};
+
+UCLASS()
+class JSONLIBRARYBLUEPRINTSUPPORT_API UK2Node_JsonLibraryForEachItem : public UK2Node_JsonLibraryForEach
+{
+	GENERATED_UCLASS_BODY()
+
+	virtual FText GetNodeTitle( ENodeTitleType::Type TitleType ) const override;
+	virtual FText GetMenuCategory() const override;
+
+protected:
+
+	virtual UScriptStruct* GetTargetType() const override;
+	virtual FName GetIterateFunctionName() const override;
+};
+
+UCLASS()
+class JSONLIBRARYBLUEPRINTSUPPORT_API UK2Node_JsonLibraryForEachProperty : public UK2Node_JsonLibraryForEach
+{
+	GENERATED_UCLASS_BODY()
+
+	virtual FText GetNodeTitle( ENodeTitleType::Type TitleType ) const override;
+	virtual FText GetMenuCategory() const override;
+
+protected:
+
+	virtual UScriptStruct* GetTargetType() const override;
+	virtual FName GetIterateFunctionName() const override;
+	virtual bool HasKeyPin() const override { return true; }
+};
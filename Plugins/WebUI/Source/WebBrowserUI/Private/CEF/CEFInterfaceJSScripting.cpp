@@ -46,6 +46,13 @@ namespace
 	}
 }
 
+FCEFInterfaceJSScripting::~FCEFInterfaceJSScripting()
+{
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReplaced.RemoveAll(this);
+#endif
+}
+
 CefRefPtr<CefDictionaryValue> FCEFInterfaceJSScripting::ConvertStruct(UStruct* TypeInfo, const void* StructPtr)
 {
 	FCEFInterfaceJSStructSerializerBackend Backend (SharedThis(this));
@@ -63,18 +70,9 @@ CefRefPtr<CefDictionaryValue> FCEFInterfaceJSScripting::ConvertObject(UObject* O
 	CefRefPtr<CefDictionaryValue> Result = CefDictionaryValue::Create();
 	RetainBinding(Object);
 
-	UClass* Class = Object->GetClass();
-	CefRefPtr<CefListValue> MethodNames = CefListValue::Create();
-	int32 MethodIndex = 0;
-	for (TFieldIterator<UFunction> FunctionIt(Class, EFieldIteratorFlags::IncludeSuper); FunctionIt; ++FunctionIt)
-	{
-		UFunction* Function = *FunctionIt;
-		MethodNames->SetString(MethodIndex++, TCHAR_TO_WCHAR(*GetBindingName(Function)));
-	}
-
 	Result->SetString("$type", "uobject");
 	Result->SetString("$id", TCHAR_TO_WCHAR(*PtrToGuid(Object).ToString(EGuidFormats::Digits)));
-	Result->SetList("$methods", MethodNames);
+	Result->SetList("$methods", GetMethodNames(Object->GetClass())->Copy());
 	return Result;
 }
 
@@ -248,48 +246,40 @@ bool FCEFInterfaceJSScripting::HandleExecuteUObjectMethodMessage(CefRefPtr<CefLi
 		return true;
 	}
 	// Coerce arguments to function arguments.
+	const FMethodPlan& Plan = GetMethodPlan(Function);
 	uint16 ParamsSize = Function->ParmsSize;
 	uint8* Params  = nullptr;
-	FProperty* ReturnParam = nullptr;
-	FProperty* PromiseParam = nullptr;
+	FProperty* ReturnParam = Plan.ReturnParam;
+	FProperty* PromiseParam = Plan.PromiseParam;
 
 	if (ParamsSize > 0)
 	{
-		// Convert cef argument list to a dictionary, so we can use FStructDeserializer to convert it for us
-		CefRefPtr<CefDictionaryValue> NamedArgs = CefDictionaryValue::Create();
-		int32 CurrentArg = 0;
+		// UFunction is a subclass of UStruct, so we can treat the arguments as a struct
+		check(nullptr == Params);
+		Params = (uint8*)FMemory::Malloc(Function->GetStructureSize());
+		Function->InitializeStruct(Params);
+
 		CefRefPtr<CefListValue> CefArgs = MessageArguments->GetList(3);
-		for ( TFieldIterator<FProperty> It(Function); It; ++It )
+		if (Plan.bDirectArguments)
 		{
-			FProperty* Param = *It;
-			if (Param->PropertyFlags & CPF_Parm)
+			// Simple arguments are written straight into the parameter struct
+			for (int32 Index = 0; Index < Plan.Arguments.Num(); Index++)
 			{
-				if (Param->PropertyFlags & CPF_ReturnParm)
-				{
-					ReturnParam = Param;
-				}
-				else
-				{
-					FStructProperty *StructProperty = CastField<FStructProperty>(Param);
-					if (StructProperty && StructProperty->Struct->IsChildOf(FWebInterfaceJSResponse::StaticStruct()))
-					{
-						PromiseParam = Param;
-					}
-					else
-					{
-						CopyContainerValue(NamedArgs, CefArgs, CefString(TCHAR_TO_WCHAR(*GetBindingName(Param))), CurrentArg);
-						CurrentArg++;
-					}
-				}
+				ReadDirectArgument(Plan, Index, Params, CefArgs);
 			}
 		}
+		else
+		{
+			// Convert cef argument list to a dictionary, so we can use FStructDeserializer to convert it for us
+			CefRefPtr<CefDictionaryValue> NamedArgs = CefDictionaryValue::Create();
+			for (int32 Index = 0; Index < Plan.Arguments.Num(); Index++)
+			{
+				CopyContainerValue(NamedArgs, CefArgs, Plan.ArgumentNames[Index], Index);
+			}
 
-		// UFunction is a subclass of UStruct, so we can treat the arguments as a struct for deserialization
-		check(nullptr == Params);
-		Params = (uint8*)FMemory::Malloc(Function->GetStructureSize());
-		Function->InitializeStruct(Params);
-		FCEFInterfaceJSStructDeserializerBackend Backend = FCEFInterfaceJSStructDeserializerBackend(SharedThis(this), NamedArgs);
-		FStructDeserializer::Deserialize(Params, *Function, Backend);
+			FCEFInterfaceJSStructDeserializerBackend Backend = FCEFInterfaceJSStructDeserializerBackend(SharedThis(this), NamedArgs);
+			FStructDeserializer::Deserialize(Params, *Function, Backend);
+		}
 	}
 
 	if (PromiseParam)
@@ -306,7 +296,9 @@ bool FCEFInterfaceJSScripting::HandleExecuteUObjectMethodMessage(CefRefPtr<CefLi
 
 	if ( ! PromiseParam ) // If PromiseParam is set, we assume that the UFunction will ensure it is called with the result
 	{
-		if ( ReturnParam )
+		// The plan is looked up again as the call may have added to or flushed the cache
+		const FMethodPlan& ReturnPlan = GetMethodPlan(Function);
+		if ( ReturnParam && !WriteDirectReturn(ReturnPlan, Params, Results) )
 		{
 			FStructSerializerPolicies ReturnPolicies;
 			ReturnPolicies.PropertyFilter = [&](const FProperty* CandidateProperty, const FProperty* ParentProperty)
@@ -318,7 +310,7 @@ bool FCEFInterfaceJSScripting::HandleExecuteUObjectMethodMessage(CefRefPtr<CefLi
 			CefRefPtr<CefDictionaryValue> ResultDict = ReturnBackend.GetResult();
 
 			// Extract the single return value from the serialized dictionary to an array
-			CopyContainerValue(Results, ResultDict, 0, TCHAR_TO_WCHAR(*GetBindingName(ReturnParam)));
+			CopyContainerValue(Results, ResultDict, 0, ReturnPlan.ReturnName);
 		}
 		InvokeJSFunction(ResultCallbackId, Results, false);
 	}
@@ -333,6 +325,221 @@ bool FCEFInterfaceJSScripting::HandleExecuteUObjectMethodMessage(CefRefPtr<CefLi
 	return true;
 }
 
+FCEFInterfaceJSScripting::EParamKind FCEFInterfaceJSScripting::GetParamKind(FProperty* Param)
+{
+	if (Param->ArrayDim != 1)
+	{
+		return EParamKind::Complex;
+	}
+
+	if (Param->IsA<FBoolProperty>())
+	{
+		return EParamKind::Bool;
+	}
+
+	if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Param))
+	{
+		if (NumericProperty->IsEnum())
+		{
+			return EParamKind::Complex;
+		}
+
+		return NumericProperty->IsFloatingPoint() ? EParamKind::Float : EParamKind::Integer;
+	}
+
+	if (Param->IsA<FStrProperty>())
+	{
+		return EParamKind::String;
+	}
+
+	if (Param->IsA<FNameProperty>())
+	{
+		return EParamKind::Name;
+	}
+
+	if (Param->IsA<FTextProperty>())
+	{
+		return EParamKind::Text;
+	}
+
+	return EParamKind::Complex;
+}
+
+const FCEFInterfaceJSScripting::FMethodPlan& FCEFInterfaceJSScripting::GetMethodPlan(UFunction* Function)
+{
+	if (const FMethodPlan* CachedPlan = MethodPlans.Find(Function))
+	{
+		return *CachedPlan;
+	}
+
+	FMethodPlan& Plan = MethodPlans.Add(Function);
+	for ( TFieldIterator<FProperty> It(Function); It; ++It )
+	{
+		FProperty* Param = *It;
+		if (Param->PropertyFlags & CPF_Parm)
+		{
+			if (Param->PropertyFlags & CPF_ReturnParm)
+			{
+				Plan.ReturnParam = Param;
+				Plan.ReturnKind = GetParamKind(Param);
+				Plan.ReturnName = TCHAR_TO_WCHAR(*GetBindingName(Param));
+			}
+			else
+			{
+				FStructProperty *StructProperty = CastField<FStructProperty>(Param);
+				if (StructProperty && StructProperty->Struct->IsChildOf(FWebInterfaceJSResponse::StaticStruct()))
+				{
+					Plan.PromiseParam = Param;
+				}
+				else
+				{
+					EParamKind Kind = GetParamKind(Param);
+					Plan.Arguments.Add(Param);
+					Plan.ArgumentKinds.Add(Kind);
+					Plan.ArgumentNames.Add(TCHAR_TO_WCHAR(*GetBindingName(Param)));
+					Plan.bDirectArguments &= Kind != EParamKind::Complex;
+				}
+			}
+		}
+	}
+
+	return Plan;
+}
+
+CefRefPtr<CefListValue> FCEFInterfaceJSScripting::GetMethodNames(UClass* Class)
+{
+	if (CefRefPtr<CefListValue>* CachedNames = ClassMethodNames.Find(Class))
+	{
+		return *CachedNames;
+	}
+
+	CefRefPtr<CefListValue> MethodNames = CefListValue::Create();
+	int32 MethodIndex = 0;
+	for (TFieldIterator<UFunction> FunctionIt(Class, EFieldIteratorFlags::IncludeSuper); FunctionIt; ++FunctionIt)
+	{
+		UFunction* Function = *FunctionIt;
+		MethodNames->SetString(MethodIndex++, TCHAR_TO_WCHAR(*GetBindingName(Function)));
+	}
+
+	ClassMethodNames.Add(Class, MethodNames);
+	return MethodNames;
+}
+
+bool FCEFInterfaceJSScripting::ReadDirectArgument(const FMethodPlan& Plan, int32 Index, uint8* Params, CefRefPtr<CefListValue> CefArgs)
+{
+	// Missing arguments keep their default values, matching the struct deserializer
+	const cef_value_type_t Type = CefArgs->GetType(Index);
+	if (Type == VTYPE_INVALID)
+	{
+		return false;
+	}
+
+	FProperty* Param = Plan.Arguments[Index];
+	void* ValuePtr = Param->ContainerPtrToValuePtr<void>(Params);
+
+	switch (Plan.ArgumentKinds[Index])
+	{
+		case EParamKind::Bool:
+		{
+			const bool bValue = Type == VTYPE_BOOL ? CefArgs->GetBool(Index)
+				: Type == VTYPE_INT ? CefArgs->GetInt(Index) != 0
+				: Type == VTYPE_DOUBLE ? static_cast<int>(CefArgs->GetDouble(Index)) != 0
+				: false;
+			CastFieldChecked<FBoolProperty>(Param)->SetPropertyValue(ValuePtr, bValue);
+			return true;
+		}
+		case EParamKind::Integer:
+		{
+			const int64 Value = Type == VTYPE_BOOL ? (CefArgs->GetBool(Index) ? 1 : 0)
+				: Type == VTYPE_INT ? CefArgs->GetInt(Index)
+				: Type == VTYPE_DOUBLE ? static_cast<int64>(CefArgs->GetDouble(Index))
+				: 0;
+			CastFieldChecked<FNumericProperty>(Param)->SetIntPropertyValue(ValuePtr, Value);
+			return true;
+		}
+		case EParamKind::Float:
+		{
+			const double Value = Type == VTYPE_BOOL ? (CefArgs->GetBool(Index) ? 1.0 : 0.0)
+				: Type == VTYPE_INT ? CefArgs->GetInt(Index)
+				: Type == VTYPE_DOUBLE ? CefArgs->GetDouble(Index)
+				: 0.0;
+			CastFieldChecked<FNumericProperty>(Param)->SetFloatingPointPropertyValue(ValuePtr, Value);
+			return true;
+		}
+		case EParamKind::String:
+		case EParamKind::Name:
+		case EParamKind::Text:
+		{
+			if (Type != VTYPE_STRING)
+			{
+				return false;
+			}
+
+			FString StringValue = WCHAR_TO_TCHAR(CefArgs->GetString(Index).ToWString().c_str());
+			if (Plan.ArgumentKinds[Index] == EParamKind::String)
+			{
+				*(FString*)ValuePtr = MoveTemp(StringValue);
+			}
+			else if (Plan.ArgumentKinds[Index] == EParamKind::Name)
+			{
+				*(FName*)ValuePtr = FName(*StringValue);
+			}
+			else
+			{
+				*(FText*)ValuePtr = FText::FromString(StringValue);
+			}
+			return true;
+		}
+		default:
+			return false;
+	}
+}
+
+bool FCEFInterfaceJSScripting::WriteDirectReturn(const FMethodPlan& Plan, const uint8* Params, CefRefPtr<CefListValue> Results)
+{
+	FProperty* Param = Plan.ReturnParam;
+	const void* ValuePtr = Param->ContainerPtrToValuePtr<void>(Params);
+
+	switch (Plan.ReturnKind)
+	{
+		case EParamKind::Bool:
+			return Results->SetBool(0, CastFieldChecked<FBoolProperty>(Param)->GetPropertyValue(ValuePtr));
+		case EParamKind::Integer:
+		{
+			// Mirror the struct serializer: types that fit in 32 bits are sent as ints, the rest as doubles
+			FNumericProperty* NumericProperty = CastFieldChecked<FNumericProperty>(Param);
+			if (Param->IsA<FIntProperty>() || Param->IsA<FInt8Property>() || Param->IsA<FInt16Property>() || Param->IsA<FUInt16Property>())
+			{
+				return Results->SetInt(0, (int32)NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+			}
+			if (Param->IsA<FUInt32Property>() || Param->IsA<FUInt64Property>() || Param->IsA<FByteProperty>())
+			{
+				return Results->SetDouble(0, (double)NumericProperty->GetUnsignedIntPropertyValue(ValuePtr));
+			}
+			return Results->SetDouble(0, (double)NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+		}
+		case EParamKind::Float:
+			return Results->SetDouble(0, CastFieldChecked<FNumericProperty>(Param)->GetFloatingPointPropertyValue(ValuePtr));
+		case EParamKind::String:
+			return Results->SetString(0, TCHAR_TO_WCHAR(**(const FString*)ValuePtr));
+		case EParamKind::Name:
+			return Results->SetString(0, TCHAR_TO_WCHAR(*((const FName*)ValuePtr)->ToString()));
+		case EParamKind::Text:
+			return Results->SetString(0, TCHAR_TO_WCHAR(*((const FText*)ValuePtr)->ToString()));
+		default:
+			return false;
+	}
+}
+
+#if WITH_EDITOR
+void FCEFInterfaceJSScripting::HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	// Recompiled classes may have gained or lost functions and parameters
+	MethodPlans.Empty();
+	ClassMethodNames.Empty();
+}
+#endif
+
 void FCEFInterfaceJSScripting::UnbindCefBrowser()
 {
 	InternalCefBrowser = nullptr;
@@ -48,7 +48,13 @@ public:
 	FCEFInterfaceJSScripting(CefRefPtr<CefBrowser> Browser, bool bJSBindingToLoweringEnabled)
 		: FWebInterfaceJSScripting(bJSBindingToLoweringEnabled)
 		, InternalCefBrowser(Browser)
-	{}
+	{
+#if WITH_EDITOR
+		FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(this, &FCEFInterfaceJSScripting::HandleObjectsReplaced);
+#endif
+	}
+
+	virtual ~FCEFInterfaceJSScripting();
 
 	void UnbindCefBrowser();
 
@@ -154,6 +160,55 @@ private:
 	bool HandleExecuteUObjectMethodMessage(CefRefPtr<CefListValue> MessageArguments);
 	bool HandleReleaseUObjectMessage(CefRefPtr<CefListValue> MessageArguments);
 
+	/** Binding metadata helpers */
+
+	/** How a single parameter is moved between a CEF value and the parameter struct. */
+	enum class EParamKind : uint8
+	{
+		Complex,
+		Bool,
+		Integer,
+		Float,
+		String,
+		Name,
+		Text
+	};
+
+	/** Cached description of how to marshal a call to a UFunction. */
+	struct FMethodPlan
+	{
+		/** Parameters filled from the JavaScript argument list, in call order. */
+		TArray<FProperty*> Arguments;
+		TArray<EParamKind> ArgumentKinds;
+		TArray<CefString> ArgumentNames;
+
+		FProperty* ReturnParam = nullptr;
+		FProperty* PromiseParam = nullptr;
+		EParamKind ReturnKind = EParamKind::Complex;
+		CefString ReturnName;
+
+		/** True when every argument can be read straight from the CEF list without the struct deserializer. */
+		bool bDirectArguments = true;
+	};
+
+	static EParamKind GetParamKind(FProperty* Param);
+
+	const FMethodPlan& GetMethodPlan(UFunction* Function);
+	CefRefPtr<CefListValue> GetMethodNames(UClass* Class);
+
+	bool ReadDirectArgument(const FMethodPlan& Plan, int32 Index, uint8* Params, CefRefPtr<CefListValue> CefArgs);
+	bool WriteDirectReturn(const FMethodPlan& Plan, const uint8* Params, CefRefPtr<CefListValue> Results);
+
+#if WITH_EDITOR
+	void HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+#endif
+
+	/** Marshaling plans for UFunctions that have been called from JavaScript. */
+	TMap<TWeakObjectPtr<UFunction>, FMethodPlan> MethodPlans;
+
+	/** Method name lists for UClasses that have been bound to JavaScript. */
+	TMap<TWeakObjectPtr<UClass>, CefRefPtr<CefListValue>> ClassMethodNames;
+
 	/** Pointer to the CEF Browser for this window. */
 	CefRefPtr<CefBrowser> InternalCefBrowser;
 };
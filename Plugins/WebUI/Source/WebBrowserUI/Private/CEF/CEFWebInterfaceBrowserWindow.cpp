@@ -5,7 +5,12 @@
 #include "UObject/Stack.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Textures/SlateUpdatableTexture.h"
+#include "Textures/SlateShaderResource.h"
+#include "RenderingThread.h"
+#include "RHICommandList.h"
 #include "HAL/PlatformApplicationMisc.h"
+#include "HAL/ThreadSafeBool.h"
+#include "WebInterfaceBrowserLog.h"
 
 #if WITH_CEF3
 
@@ -14,6 +19,7 @@
 #include "CEFInterfaceBrowserClosureTask.h"
 #include "CEFInterfaceJSScripting.h"
 #include "CEFInterfaceImeHandler.h"
+#include "WebInterfaceDataChannel.h"
 #include "Async/Async.h"
 
 #if PLATFORM_MAC
@@ -255,27 +261,131 @@ namespace {
 }
 
 
-// Private helper class to smooth out video buffering, using a ringbuffer
-// (cef sometimes submits multiple frames per engine frame)
+DECLARE_STATS_GROUP(TEXT("WebInterface"), STATGROUP_WebInterface, STATCAT_Advanced);
+DECLARE_MEMORY_STAT(TEXT("Buffered Video Memory"), STAT_WebInterfaceBufferedVideoMemory, STATGROUP_WebInterface);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Buffered Video Pool Misses"), STAT_WebInterfaceBufferedVideoPoolMisses, STATGROUP_WebInterface);
+
+// Private helper class holding a fixed set of page-aligned upload buffers, shared by the game thread that fills them
+// and the render thread that hands them back once their area has been written into the texture
+class FBrowserVideoUploadRing
+{
+public:
+	static const int32 NumBuffers = 3;
+
+	FBrowserVideoUploadRing()
+		: NextBuffer(0)
+	{
+	}
+
+	~FBrowserVideoUploadRing()
+	{
+		for (FBuffer& Buffer : Buffers)
+		{
+			if (Buffer.Data != nullptr)
+			{
+				DEC_MEMORY_STAT_BY(STAT_WebInterfaceBufferedVideoMemory, Buffer.Capacity);
+				FMemory::Free(Buffer.Data);
+			}
+		}
+	}
+
+	/** @return the index of a free buffer holding at least Size bytes, or INDEX_NONE if the render thread still has all of them */
+	int32 Acquire(SIZE_T Size)
+	{
+		check(IsInGameThread());
+		for (int32 Offset = 0; Offset < NumBuffers; ++Offset)
+		{
+			const int32 Index = (NextBuffer + Offset) % NumBuffers;
+			FBuffer& Buffer = Buffers[Index];
+			if (!Buffer.bInUse)
+			{
+				// Buffers only ever grow, so a steady dirty area stops allocating after the first few frames
+				if (Size > Buffer.Capacity)
+				{
+					if (Buffer.Data != nullptr)
+					{
+						DEC_MEMORY_STAT_BY(STAT_WebInterfaceBufferedVideoMemory, Buffer.Capacity);
+						FMemory::Free(Buffer.Data);
+					}
+
+					const SIZE_T PageSize = FPlatformMemory::GetConstants().PageSize;
+					Buffer.Capacity = Align(Size, PageSize);
+					Buffer.Data = (uint8*)FMemory::Malloc(Buffer.Capacity, PageSize);
+					INC_MEMORY_STAT_BY(STAT_WebInterfaceBufferedVideoMemory, Buffer.Capacity);
+				}
+
+				Buffer.bInUse = true;
+				NextBuffer = (Index + 1) % NumBuffers;
+				return Index;
+			}
+		}
+
+		return INDEX_NONE;
+	}
+
+	uint8* GetData(int32 Index) const
+	{
+		return Buffers[Index].Data;
+	}
+
+	/** Called on the render thread once a buffer has been uploaded */
+	void Release(int32 Index)
+	{
+		Buffers[Index].bInUse = false;
+	}
+
+private:
+	struct FBuffer
+	{
+		FBuffer()
+			: Data(nullptr)
+			, Capacity(0)
+		{
+		}
+
+		uint8* Data;
+		SIZE_T Capacity;
+		FThreadSafeBool bInUse;
+	};
+
+	FBuffer Buffers[NumBuffers];
+	int32 NextBuffer;
+};
+
+// Private helper class to smooth out video buffering, using a persistent staging frame
+// (cef sometimes submits multiple frames per engine frame, so their dirty areas are merged and only that area is uploaded once per engine tick)
 class FBrowserBufferedVideo
 {
 public:
-	FBrowserBufferedVideo(uint32 NumFrames) 
-		: FrameWriteIndex(0)
-		, FrameReadIndex(0)
+	FBrowserBufferedVideo()
+		: StagingFrame(nullptr)
+		, StagingCapacity(0)
+		, FrameSize(FIntPoint::ZeroValue)
+		, PendingDirty(0, 0, 0, 0)
+		, UploadedTexture(nullptr)
+		, UploadedSize(FIntPoint::ZeroValue)
+		, UploadRing(MakeShared<FBrowserVideoUploadRing, ESPMode::ThreadSafe>())
+		, PoolMisses(0)
 		, FrameCountThisEngineTick(0)
-		, FrameCount(0)
-		, FrameNumberOfLastRender(-1)
 	{
-		Frames.SetNum(NumFrames);
 	}
 
 	~FBrowserBufferedVideo()
 	{
+		if (GetPoolMisses() > 0)
+		{
+			UE_LOG(LogWebInterfaceBrowser, Verbose, TEXT("Buffered video uploaded %d frames outside its buffer ring"), GetPoolMisses());
+		}
+
+		if (StagingFrame != nullptr)
+		{
+			DEC_MEMORY_STAT_BY(STAT_WebInterfaceBufferedVideoMemory, StagingCapacity);
+			FMemory::Free(StagingFrame);
+		}
 	}
 
 	/**
-	* Submits a frame to the video buffer
+	* Submits a frame to the video buffer, copying only its dirty area into the staging frame
 	* @return true if this is the first frame submitted this engine tick, or false otherwise
 	*/
 	bool SubmitFrame(
@@ -287,83 +397,202 @@ public:
 		check(IsInGameThread());
 		check(Buffer != nullptr);
 
-		const uint32 NumBytesPerPixel = 4;
-		FFrame& Frame = Frames[FrameWriteIndex];
+		const FIntRect FrameRect(0, 0, InWidth, InHeight);
 
-		// If the write buffer catches up to the read buffer, we need to release the read buffer and increment its index
-		if (FrameWriteIndex == FrameReadIndex && FrameCount > 0)
+		// A resized frame replaces the staging frame in full
+		if (FrameSize != FIntPoint(InWidth, InHeight))
 		{
-			Frame.ReleaseTextureData();
-			FrameReadIndex = (FrameReadIndex + 1) % Frames.Num();
+			FrameSize = FIntPoint(InWidth, InHeight);
+			ReserveStaging((SIZE_T)InWidth * InHeight * NumBytesPerPixel);
+			Dirty = FrameRect;
+			PendingDirty = FrameRect;
+		}
+		else if (Dirty.Area() <= 0)
+		{
+			Dirty = FrameRect;
 		}
 
-		check(Frame.SlateTextureData == nullptr);
-		Frame.SlateTextureData = new FSlateTextureData((uint8*)Buffer, InWidth, InHeight, NumBytesPerPixel);
+		Dirty.Clip(FrameRect);
+		if (Dirty.Area() > 0)
+		{
+			const int32 Stride = InWidth * NumBytesPerPixel;
+			const int32 RowSize = Dirty.Width() * NumBytesPerPixel;
+			const uint8* Source = static_cast<const uint8*>(Buffer) + Dirty.Min.Y * Stride + Dirty.Min.X * NumBytesPerPixel;
+			uint8* Target = StagingFrame + Dirty.Min.Y * Stride + Dirty.Min.X * NumBytesPerPixel;
+			if (RowSize == Stride)
+			{
+				FMemory::Memcpy(Target, Source, RowSize * Dirty.Height());
+			}
+			else
+			{
+				for (int32 Y = Dirty.Min.Y; Y < Dirty.Max.Y; ++Y, Source += Stride, Target += Stride)
+				{
+					FMemory::Memcpy(Target, Source, RowSize);
+				}
+			}
+
+			if (PendingDirty.Area() > 0)
+			{
+				PendingDirty.Union(Dirty);
+			}
+			else
+			{
+				PendingDirty = Dirty;
+			}
+		}
 
-		FrameWriteIndex = (FrameWriteIndex + 1) % Frames.Num();
-		FrameCount = FMath::Min(Frames.Num(), FrameCount + 1);
 		FrameCountThisEngineTick++;
 
 		return FrameCountThisEngineTick == 1;
 	}
 
-    /**
-     * Called once per frame to get the next frame's texturedata
-     * @return The texture data. Can be nullptr if no frame is available
-     */
-	FSlateTextureData* GetNextFrameTextureData()
+	/**
+	 * Called once per frame to upload the area that changed since the last engine tick
+	 * @param Texture The texture to update
+	 * @return true if the texture was updated, or false if nothing changed
+	 */
+	bool UpdateTexture(FSlateUpdatableTexture* Texture)
 	{
-		// Grab the next available frame if available. Ensure we don't grab more than one frame per engine tick
 		check(IsInGameThread());
-		FSlateTextureData* SlateTextureData = nullptr;
-		if ( FrameCount > 0 )
+		FrameCountThisEngineTick = 0;
+		if (Texture == nullptr || PendingDirty.Area() <= 0)
+		{
+			return false;
+		}
+
+		// A new or resized texture is replaced in full, as that is what resizes it
+		if (Texture != UploadedTexture || FrameSize != UploadedSize)
 		{
-			// Grab the first frame we haven't submitted yet 
-			FFrame& Frame = Frames[FrameReadIndex];
-			SlateTextureData = Frame.SlateTextureData;
-			
-			// Set this to NULL because the renderthread is taking ownership
-			Frame.SlateTextureData = nullptr; 
-			FrameReadIndex = (FrameReadIndex + 1) % Frames.Num();
-			FrameCount--;
+			Texture->UpdateTextureThreadSafeRaw(FrameSize.X, FrameSize.Y, StagingFrame);
+			UploadedTexture = Texture;
+			UploadedSize = FrameSize;
 		}
-		FrameCountThisEngineTick = 0;
-		return SlateTextureData;
+		else
+		{
+			UploadRegion(Texture, PendingDirty);
+		}
+
+		PendingDirty = FIntRect(0, 0, 0, 0);
+		return true;
+	}
+
+	/** @return the number of uploads that found every ring buffer still with the render thread, and had to allocate memory of their own */
+	int32 GetPoolMisses() const
+	{
+		return PoolMisses;
+	}
+
+	/** Called when the texture is released, so the next upload replaces whatever texture takes its place in full */
+	void ReleaseTexture()
+	{
+		UploadedTexture = nullptr;
+		UploadedSize = FIntPoint::ZeroValue;
 	}
 
 private:
-	struct FFrame
+	static const int32 NumBytesPerPixel = 4;
+
+	/** Copies an area of the staging frame into a ring buffer, and uploads just that area on the render thread */
+	void UploadRegion(FSlateUpdatableTexture* Texture, const FIntRect& Region)
 	{
-		FFrame()
-			: SlateTextureData(nullptr) 
-		{}
-		
-		~FFrame()
+		const int32 Stride = FrameSize.X * NumBytesPerPixel;
+		const int32 RowSize = Region.Width() * NumBytesPerPixel;
+		const SIZE_T RegionSize = (SIZE_T)RowSize * Region.Height();
+
+		// Only when the render thread is far enough behind to hold every ring buffer does a frame allocate
+		const int32 RingIndex = UploadRing->Acquire(RegionSize);
+		uint8* RegionData = nullptr;
+		if (RingIndex != INDEX_NONE)
 		{
-			ReleaseTextureData();
+			RegionData = UploadRing->GetData(RingIndex);
+		}
+		else
+		{
+			RegionData = (uint8*)FMemory::Malloc(RegionSize);
+			PoolMisses++;
+			INC_DWORD_STAT(STAT_WebInterfaceBufferedVideoPoolMisses);
 		}
 
-		void ReleaseTextureData()
+		const uint8* Source = StagingFrame + Region.Min.Y * Stride + Region.Min.X * NumBytesPerPixel;
+		uint8* Target = RegionData;
+		for (int32 Y = Region.Min.Y; Y < Region.Max.Y; ++Y, Source += Stride, Target += RowSize)
 		{
-			if (SlateTextureData)
+			FMemory::Memcpy(Target, Source, RowSize);
+		}
+
+		ENQUEUE_RENDER_COMMAND(UpdateWebInterfaceBufferedVideo)(
+			[Ring = UploadRing, RingIndex, Texture, Region, RowSize, RegionData](FRHICommandListImmediate& RHICmdList)
 			{
-				delete SlateTextureData;
-			}
-			SlateTextureData = nullptr;
+				UpdateTextureRegion_RenderThread(Texture, Region, RowSize, RegionData);
+				if (RingIndex != INDEX_NONE)
+				{
+					Ring->Release(RingIndex);
+				}
+				else
+				{
+					FMemory::Free(RegionData);
+				}
+			});
+	}
+
+	/** Writes an area into the texture behind a Slate updatable texture, leaving the rest of it untouched */
+	static void UpdateTextureRegion_RenderThread(FSlateUpdatableTexture* Texture, const FIntRect& Region, uint32 SourcePitch, const uint8* SourceData)
+	{
+		check(IsInRenderingThread());
+
+		FSlateShaderResource* Resource = Texture->GetSlateResource();
+		if (Resource == nullptr || Resource->GetType() != ESlateShaderResource::NativeTexture)
+		{
+			return;
 		}
 
-		FSlateTextureData* SlateTextureData;
-	};
+		FTexture2DRHIRef& RHITexture = static_cast<TSlateTexture<FTexture2DRHIRef>*>(Resource)->GetTypedResource();
+		if (RHITexture.IsValid() && RHITexture->GetSizeX() >= (uint32)Region.Max.X && RHITexture->GetSizeY() >= (uint32)Region.Max.Y)
+		{
+			const FUpdateTextureRegion2D UpdateRegion(Region.Min.X, Region.Min.Y, 0, 0, Region.Width(), Region.Height());
+			RHIUpdateTexture2D(RHITexture, 0, UpdateRegion, SourcePitch, SourceData);
+		}
+	}
+
+	/** Makes sure the staging memory can hold a frame; it only ever grows, so resizing back and forth does not allocate */
+	void ReserveStaging(SIZE_T Size)
+	{
+		if (Size <= StagingCapacity)
+		{
+			return;
+		}
+
+		if (StagingFrame != nullptr)
+		{
+			DEC_MEMORY_STAT_BY(STAT_WebInterfaceBufferedVideoMemory, StagingCapacity);
+			FMemory::Free(StagingFrame);
+		}
+
+		// Page aligned and rounded up to whole pages, so the frame never shares pages with other allocations
+		const SIZE_T PageSize = FPlatformMemory::GetConstants().PageSize;
+		StagingCapacity = Align(Size, PageSize);
+		StagingFrame = (uint8*)FMemory::Malloc(StagingCapacity, PageSize);
 
-	TArray<FFrame> Frames;
+		INC_MEMORY_STAT_BY(STAT_WebInterfaceBufferedVideoMemory, StagingCapacity);
+	}
+
+	// Last painted frame, kept between paints so only dirty areas are copied into it
+	uint8* StagingFrame;
+	SIZE_T StagingCapacity;
+	FIntPoint FrameSize;
+
+	// Union of the areas painted since the last upload
+	FIntRect PendingDirty;
 
-	// Read/write position in the ringbuffer
-	int32 FrameWriteIndex;
-	int32 FrameReadIndex;
+	// Texture and size of the last full upload; anything else needs a full upload before areas can be written into it
+	FSlateUpdatableTexture* UploadedTexture;
+	FIntPoint UploadedSize;
+
+	// Held by pending render commands too, so buffers outlive this class until their uploads are done
+	TSharedRef<FBrowserVideoUploadRing, ESPMode::ThreadSafe> UploadRing;
+	int32 PoolMisses;
 
 	int32 FrameCountThisEngineTick;
-	int32 FrameCount;
-	int32 FrameNumberOfLastRender;
 };
 
 
@@ -400,6 +629,9 @@ FCEFWebInterfaceBrowserWindow::FCEFWebInterfaceBrowserWindow(CefRefPtr<CefBrowse
 	, bRecoverFromRenderProcessCrash(false)
 	, ErrorCode(0)
 	, bDeferNavigations(false)
+	, CoverageSize(FIntPoint::ZeroValue)
+	, CoverageStride(0)
+	, CoverageThreshold(-1)
 	, Scripting(new FCEFInterfaceJSScripting(InBrowser, bInJSBindingToLoweringEnabled))
 #if !PLATFORM_LINUX
 	, Ime(new FCEFInterfaceImeHandler(InBrowser))
@@ -416,8 +648,12 @@ FCEFWebInterfaceBrowserWindow::FCEFWebInterfaceBrowserWindow(CefRefPtr<CefBrowse
 	}
 
 #if USE_BUFFERED_VIDEO
-	BufferedVideo = TUniquePtr<FBrowserBufferedVideo>(new FBrowserBufferedVideo(4));
+	BufferedVideo = TUniquePtr<FBrowserBufferedVideo>(new FBrowserBufferedVideo());
 #endif
+
+	// Permanent, so every page the browser navigates to finds ue.data
+	DataChannel = NewObject<UWebInterfaceDataChannel>();
+	Scripting->BindUObject(TEXT("data"), DataChannel, true);
 }
 
 void FCEFWebInterfaceBrowserWindow::ReleaseTextures()
@@ -441,6 +677,11 @@ void FCEFWebInterfaceBrowserWindow::ReleaseTextures()
 			UpdatableTextures[I] = nullptr;
 		}
 	}
+
+	if (BufferedVideo.IsValid())
+	{
+		BufferedVideo->ReleaseTexture();
+	}
 }
 
 bool FCEFWebInterfaceBrowserWindow::CreateInitialTextures()
@@ -591,6 +832,82 @@ FSlateShaderResource* FCEFWebInterfaceBrowserWindow::GetTexture(bool bIsPopup)
 	return nullptr;
 }
 
+bool FCEFWebInterfaceBrowserWindow::HitTestPixel(int32 X, int32 Y, uint8 Threshold, bool& bOutHit)
+{
+	{
+		FScopeLock Lock(&CoverageSection);
+		if (CoverageThreshold == Threshold)
+		{
+			if (X < 0 || Y < 0 || X >= CoverageSize.X || Y >= CoverageSize.Y)
+			{
+				return false;
+			}
+
+			bOutHit = (CoverageMask[Y * CoverageStride + (X >> 5)] & (1u << (X & 31))) != 0;
+			return true;
+		}
+
+		// Start mapping at the new threshold; the next paint fills the map in full
+		CoverageThreshold = Threshold;
+		CoverageSize = FIntPoint::ZeroValue;
+		CoverageMask.Reset();
+	}
+
+	// Ask for a paint so the map does not wait for the page to change
+	if (IsValid())
+	{
+		InternalCefBrowser->GetHost()->Invalidate(PET_VIEW);
+	}
+
+	return false;
+}
+
+void FCEFWebInterfaceBrowserWindow::UpdateCoverage(const void* Buffer, int Width, int Height, const FIntRect& Dirty)
+{
+	FScopeLock Lock(&CoverageSection);
+	if (CoverageThreshold < 0 || Buffer == nullptr || Width <= 0 || Height <= 0)
+	{
+		return;
+	}
+
+	// The buffer always holds the whole view, so a new or resized map is filled from it in full
+	FIntRect Rect = Dirty;
+	if (CoverageSize != FIntPoint(Width, Height))
+	{
+		CoverageSize = FIntPoint(Width, Height);
+		CoverageStride = (Width + 31) / 32;
+		CoverageMask.SetNumZeroed(CoverageStride * Height);
+		Rect = FIntRect(0, 0, Width, Height);
+	}
+	else if (Rect.Area() <= 0)
+	{
+		Rect = FIntRect(0, 0, Width, Height);
+	}
+
+	Rect.Clip(FIntRect(0, 0, Width, Height));
+
+	// CEF paints BGRA, so the alpha is every fourth byte
+	const uint8 Threshold = (uint8)CoverageThreshold;
+	const uint8* Pixels = static_cast<const uint8*>(Buffer);
+	for (int32 Y = Rect.Min.Y; Y < Rect.Max.Y; ++Y)
+	{
+		const uint8* Source = Pixels + (Y * Width + Rect.Min.X) * 4 + 3;
+		uint32* Row = CoverageMask.GetData() + Y * CoverageStride;
+		for (int32 X = Rect.Min.X; X < Rect.Max.X; ++X, Source += 4)
+		{
+			const uint32 Bit = 1u << (X & 31);
+			if (*Source >= Threshold)
+			{
+				Row[X >> 5] |= Bit;
+			}
+			else
+			{
+				Row[X >> 5] &= ~Bit;
+			}
+		}
+	}
+}
+
 bool FCEFWebInterfaceBrowserWindow::IsValid() const
 {
 	return InternalCefBrowser.get() != nullptr;
@@ -1719,6 +2036,11 @@ void FCEFWebInterfaceBrowserWindow::OnPaint(CefRenderHandler::PaintElementType T
 		// In case that should change in the future, we'll simply update the entire area if DirtyRects is not a single element.
 		FIntRect Dirty = (DirtyRects.size() == 1) ? FIntRect(DirtyRects[0].x, DirtyRects[0].y, DirtyRects[0].x + DirtyRects[0].width, DirtyRects[0].y + DirtyRects[0].height) : FIntRect();
 
+		if (Type == PET_VIEW)
+		{
+			UpdateCoverage(Buffer, Width, Height, Dirty);
+		}
+
 		if (Type == PET_VIEW && BufferedVideo.IsValid() )
 		{
 			// If we're using bufferedVideo, submit the frame to it
@@ -1757,10 +2079,8 @@ void FCEFWebInterfaceBrowserWindow::UpdateVideoBuffering()
 {
 	if (BufferedVideo.IsValid() && UpdatableTextures[PET_VIEW] != nullptr )
 	{
-		FSlateTextureData* SlateTextureData = BufferedVideo->GetNextFrameTextureData();
-		if (SlateTextureData != nullptr )
+		if (BufferedVideo->UpdateTexture(UpdatableTextures[PET_VIEW]))
 		{
-			UpdatableTextures[PET_VIEW]->UpdateTextureThreadSafeWithTextureData(SlateTextureData);
 			HandleRenderingError();
 		}
 	}
@@ -2313,6 +2633,30 @@ void FCEFWebInterfaceBrowserWindow::SetIsDisabled(bool bValue)
 	SetIsHidden(bIsDisabled);
 }
 
+void FCEFWebInterfaceBrowserWindow::PostData(const FString& Channel, const float* Data, int32 Count)
+{
+	if (DataChannel != nullptr)
+	{
+		DataChannel->Post(Channel, Data, Count);
+	}
+}
+
+void FCEFWebInterfaceBrowserWindow::FlushData()
+{
+	if (DataChannel != nullptr && IsValid())
+	{
+		DataChannel->Flush();
+	}
+}
+
+void FCEFWebInterfaceBrowserWindow::SetFrameRate(int32 FrameRate)
+{
+	if (IsValid())
+	{
+		InternalCefBrowser->GetHost()->SetWindowlessFrameRate(FMath::Clamp(FrameRate, 1, 60));
+	}
+}
+
 TSharedPtr<SWindow> FCEFWebInterfaceBrowserWindow::GetParentWindow() const
 {
 	return ParentWindow;
@@ -58,6 +58,7 @@ struct FInputEvent;
 class FWebJSScripting;
 class FCEFInterfaceImeHandler;
 class ITextInputMethodSystem;
+class UWebInterfaceDataChannel;
 
 #if WITH_CEF3
 
@@ -142,6 +143,7 @@ public:
 	virtual void SetViewportSize(FIntPoint WindowSize, FIntPoint WindowPos) override;
 	virtual FIntPoint GetViewportSize() const override { return FIntPoint::NoneValue; }
 	virtual FSlateShaderResource* GetTexture(bool bIsPopup = false) override;
+	virtual bool HitTestPixel(int32 X, int32 Y, uint8 Threshold, bool& bOutHit) override;
 	virtual bool IsValid() const override;
 	virtual bool IsInitialized() const override;
 	virtual bool IsClosing() const override;
@@ -177,6 +179,9 @@ public:
 	virtual void UnbindInputMethodSystem() override;
 	virtual int GetLoadError() override;
 	virtual void SetIsDisabled(bool bValue) override;
+	virtual void SetFrameRate(int32 FrameRate) override;
+	virtual void PostData(const FString& Channel, const float* Data, int32 Count) override;
+	virtual void FlushData() override;
 	virtual TSharedPtr<SWindow> GetParentWindow() const override;
 	virtual void SetParentWindow(TSharedPtr<SWindow> Window) override;
 
@@ -571,6 +576,9 @@ private:
 	/** Creates the initial updatable textures */
 	bool CreateInitialTextures();
 
+	/** Maps the painted area of the view against the hit test threshold, once a hit test has been made */
+	void UpdateCoverage(const void* Buffer, int Width, int Height, const FIntRect& Dirty);
+
 	/** Executes or defers a LoadUrl navigation */
 	void RequestNavigationInternal(FString Url, FString Contents);
 
@@ -753,9 +761,19 @@ private:
 
 	TUniquePtr<FBrowserBufferedVideo> BufferedVideo;
 
+	/** One bit per pixel of the last painted view, set where the alpha reaches the threshold; only kept once a hit test has been made. */
+	TArray<uint32> CoverageMask;
+	FIntPoint CoverageSize;
+	int32 CoverageStride;
+	int32 CoverageThreshold;
+	FCriticalSection CoverageSection;
+
 	/** Handling of passing and marshalling messages for JS integration is delegated to a helper class*/
 	TSharedPtr<FCEFInterfaceJSScripting> Scripting;
 
+	/** Bound to ue.data in the page; kept alive by the scripting helper like any other bound object */
+	UWebInterfaceDataChannel* DataChannel;
+
 #if !PLATFORM_LINUX
 	/** Handling of foreign language character input is delegated to a helper class */
 	TSharedPtr<FCEFInterfaceImeHandler> Ime;
@@ -0,0 +1,53 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+
+#include "WebInterfaceDataChannel.h"
+
+namespace
+{
+	/** Most values a channel holds between flushes (16 MB of floats) */
+	const int32 MaxPendingValues = 4 * 1024 * 1024;
+}
+
+void UWebInterfaceDataChannel::Subscribe(FWebInterfaceJSFunction InReceiver)
+{
+	Receiver = InReceiver;
+}
+
+bool UWebInterfaceDataChannel::IsSubscribed() const
+{
+	return Receiver.IsValid();
+}
+
+void UWebInterfaceDataChannel::Post(const FString& Channel, const float* Data, int32 Count)
+{
+	// Nothing is kept until the page is listening, so an idle page never grows the queue
+	if (!IsSubscribed() || Data == nullptr || Count <= 0)
+	{
+		return;
+	}
+
+	// A hidden widget is not ticked and so never flushes; keep only the newest values rather than growing without bound
+	TArray<float>& Values = Pending.FindOrAdd(Channel);
+	if (Values.Num() + Count > MaxPendingValues)
+	{
+		Values.Reset();
+	}
+
+	Values.Append(Data, Count);
+}
+
+void UWebInterfaceDataChannel::Flush()
+{
+	if (Pending.Num() == 0)
+	{
+		return;
+	}
+
+	// The numbers travel as a list value in one process message, and the renderer turns them straight into arrays
+	if (IsSubscribed())
+	{
+		Receiver(Pending);
+	}
+
+	Pending.Reset();
+}
@@ -73,6 +73,17 @@ public:
 	 */
 	virtual FSlateShaderResource* GetTexture(bool bIsPopup = false) = 0;
 
+	/**
+	 * Tests a pixel against a CPU coverage map of the last painted frame, without waiting on the render thread
+	 *
+	 * @param X Horizontal position in the texture.
+	 * @param Y Vertical position in the texture.
+	 * @param Threshold The lowest alpha that counts as a hit.
+	 * @param bOutHit Whether the alpha of the pixel reaches the threshold.
+	 * @return false if the pixel is outside the texture, or no frame has been mapped at this threshold yet.
+	 */
+	virtual bool HitTestPixel(int32 X, int32 Y, uint8 Threshold, bool& bOutHit) { return false; }
+
 	/**
 	 * Checks whether the web browser is valid and ready for use
 	 */
@@ -297,6 +308,25 @@ public:
 	 */
 	virtual void SetIsDisabled(bool bValue) = 0;
 
+	/**
+	 * Change how often the background web browser paints.
+	 *
+	 * @param FrameRate The framerate of the browser in FPS.
+	 */
+	virtual void SetFrameRate(int32 FrameRate) {}
+
+	/**
+	 * Queue numbers for the page, delivered to the function registered with ue.data.subscribe on the next flush.
+	 *
+	 * @param Channel The name of the array in the batch.
+	 * @param Data The numbers to append.
+	 * @param Count The number of values in Data.
+	 */
+	virtual void PostData(const FString& Channel, const float* Data, int32 Count) {}
+
+	/** Deliver all data queued since the last flush to the page in a single message. */
+	virtual void FlushData() {}
+
 	/**
 	* Get parent SWindow for this window
 	*/
@@ -0,0 +1,48 @@
+// Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "WebInterfaceJSFunction.h"
+#include "WebInterfaceDataChannel.generated.h"
+
+/**
+ * Delivers batches of numbers to a page through process messages, without compiling any script.
+ * The page registers a receiver with ue.data.subscribe(function(batch) {...}) and every flush calls it once,
+ * with an object holding an array of numbers for each channel posted since the last flush.
+ */
+UCLASS()
+class WEBBROWSERUI_API UWebInterfaceDataChannel : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Called by the page to register the function that receives each batch. */
+	UFUNCTION()
+	void Subscribe(FWebInterfaceJSFunction InReceiver);
+
+	/** @return true if the page has registered a receiver */
+	bool IsSubscribed() const;
+
+	/**
+	 * Queues numbers on a channel until the next flush.
+	 *
+	 * @param Channel The name of the array in the batch.
+	 * @param Data The numbers to append.
+	 * @param Count The number of values in Data.
+	 */
+	void Post(const FString& Channel, const float* Data, int32 Count);
+
+	/** Sends everything queued since the last flush as a single message. */
+	void Flush();
+
+private:
+
+	/** The page function that receives each batch. */
+	FWebInterfaceJSFunction Receiver;
+
+	/** Numbers queued for each channel since the last flush. */
+	TMap<FString, TArray<float>> Pending;
+};
@@ -14,6 +14,7 @@ public class WebBrowserUI : ModuleRules
 				"CoreUObject",
 				"ApplicationCore",
 				"RHI",
+				"RenderCore",
 				"InputCore",
 				"Serialization",
 				"HTTP"
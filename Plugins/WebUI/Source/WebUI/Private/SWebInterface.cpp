@@ -12,6 +12,7 @@
 #include "IWebInterfaceBrowserSingleton.h"
 #include "IWebInterfaceBrowserWindow.h"
 #endif
+#include "WebInterface.h"
 #include "RenderUtils.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Input/Events.h"
@@ -35,10 +36,28 @@ SWebInterface::SWebInterface()
 	LastMousePixel = FLinearColor::White;
 	LastMouseTime  = 0.0f;
 	LastMouseTick  = 0.0f;
+
+	bAdaptiveFrameRate = false;
+	FrameRate          = 60;
+	IdleFrameRate      = 5;
+	IdleDelay          = 1.0f;
+	FrameTimeBudget    = 0.0f;
+
+	MaxCallRate  = 0.0f;
+	LastTickTime = 0.0;
+
+	CurrentFrameRate = 60;
+	IdleTime         = 0.0f;
+	AverageDeltaTime = 0.0f;
 }
 
 SWebInterface::~SWebInterface()
 {
+#if !PLATFORM_ANDROID && !PLATFORM_IOS
+	if ( BrowserWindow.IsValid() )
+		BrowserWindow->OnNeedsRedraw().RemoveAll( this );
+#endif
+
 #if UE_BUILD_DEVELOPMENT || UE_BUILD_DEBUG
 	for ( TPair<TWeakPtr<IWebInterfaceBrowserWindow>, TWeakPtr<SWindow>> Temp : BrowserWindowWidgets )
 	{
@@ -81,6 +100,14 @@ void SWebInterface::Construct( const FArguments& InArgs )
 	TransparencyDelay     = FMath::Max( 0.0f, InArgs._TransparencyDelay );
 	TransparencyThreshold = FMath::Clamp( InArgs._TransparencyThreshold, 0.0f, 1.0f );
 	TransparencyTick      = FMath::Max( 0.0f, InArgs._TransparencyTick );
+
+	bAdaptiveFrameRate = InArgs._EnableAdaptiveFrameRate;
+	FrameRate          = FMath::Clamp( InArgs._FrameRate, 1, 60 );
+	IdleFrameRate      = FMath::Clamp( InArgs._IdleFrameRate, 1, FrameRate );
+	IdleDelay          = FMath::Max( 0.0f, InArgs._IdleDelay );
+	FrameTimeBudget    = FMath::Max( 0.0f, InArgs._FrameTimeBudget );
+	CurrentFrameRate   = FrameRate;
+	MaxCallRate        = FMath::Max( 0.0f, InArgs._MaxCallRate );
 	
 #if PLATFORM_ANDROID || PLATFORM_IOS
 	FCreateBrowserWindowSettings Settings;
@@ -88,7 +115,7 @@ void SWebInterface::Construct( const FArguments& InArgs )
 	FCreateInterfaceBrowserWindowSettings Settings;
 	Settings.bUseNativeCursors = InArgs._NativeCursors;
 #endif
-	Settings.BrowserFrameRate  = FMath::Clamp( InArgs._FrameRate, 1, 60 );
+	Settings.BrowserFrameRate  = FrameRate;
 	Settings.bUseTransparency  = true;
 	Settings.BackgroundColor   = InArgs._BackgroundColor;
 	Settings.InitialURL        = InArgs._InitialURL;
@@ -108,6 +135,12 @@ void SWebInterface::Construct( const FArguments& InArgs )
 		BrowserWindow = Singleton->CreateBrowserWindow( Settings );
 	}
 
+#if !PLATFORM_ANDROID && !PLATFORM_IOS
+	// every paint means the page changed, which keeps it at the full frame rate
+	if ( BrowserWindow.IsValid() && bAdaptiveFrameRate )
+		BrowserWindow->OnNeedsRedraw().AddSP( this, &SWebInterface::HandleNeedsRedraw );
+#endif
+
 	ChildSlot
 	[
 		SAssignNew( BrowserView, SWebInterfaceBrowserView, BrowserWindow )
@@ -144,6 +177,28 @@ void SWebInterface::Construct( const FArguments& InArgs )
 void SWebInterface::Tick( const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime )
 {
 	SWidget::Tick( AllottedGeometry, InCurrentTime, InDeltaTime );
+
+	// everything called or posted this frame goes to the page as one script and one message
+	LastTickTime = FPlatformTime::Seconds();
+	FlushCalls();
+	FlushData();
+
+	if ( HasAdaptiveFrameRate() )
+	{
+		// hidden widgets stop ticking, and the browser window already stops painting when that happens
+		IdleTime         = IdleTime + InDeltaTime;
+		AverageDeltaTime = FMath::Lerp( AverageDeltaTime, InDeltaTime, 0.1f );
+
+		// input only counts while the user is pointing at or typing into this widget
+		const double LastInput = FSlateApplication::IsInitialized() ? FSlateApplication::Get().GetLastUserInteractionTime() : 0.0;
+		const bool   bInput    = ( IsHovered() || HasFocusedDescendants() ) && LastInput >= InCurrentTime - InDeltaTime;
+		const bool   bPressure = FrameTimeBudget > 0.0f && AverageDeltaTime * 1000.0f > FrameTimeBudget;
+		if ( bInput )
+			IdleTime = 0.0f;
+
+		UpdateFrameRate( bInput || ( IdleTime < IdleDelay && !bPressure ) ? FrameRate : IdleFrameRate );
+	}
+
 	if ( HasMouseTransparency() )
 	{
 		if ( FSlateApplication::IsInitialized() && ( TransparencyTick <= 0.0f
@@ -171,7 +226,8 @@ void SWebInterface::Tick( const FGeometry& AllottedGeometry, const double InCurr
 						int32 X = FMath::FloorToInt( LocalUV.X * GetTextureWidth() );
 						int32 Y = FMath::FloorToInt( LocalUV.Y * GetTextureHeight() );
 		
-						FLinearColor Pixel = ReadTexturePixel( X, Y );
+						FLinearColor Pixel = HitTestTexture( X, Y ) ? FLinearColor::White : FLinearColor::Transparent;
+
 						if ( ( Pixel.A <  TransparencyThreshold && LastMousePixel.A >= TransparencyThreshold )
 						  || ( Pixel.A >= TransparencyThreshold && LastMousePixel.A <  TransparencyThreshold ) )
 							LastMouseTime = 0.0f;
@@ -201,6 +257,23 @@ EVisibility SWebInterface::GetViewportVisibility() const
 	return EVisibility::Visible;
 }
 
+void SWebInterface::UpdateFrameRate( int32 NewFrameRate )
+{
+	if ( NewFrameRate == CurrentFrameRate )
+		return;
+
+	CurrentFrameRate = NewFrameRate;
+#if !PLATFORM_ANDROID && !PLATFORM_IOS
+	if ( BrowserWindow.IsValid() )
+		BrowserWindow->SetFrameRate( CurrentFrameRate );
+#endif
+}
+
+void SWebInterface::HandleNeedsRedraw()
+{
+	IdleTime = 0.0f;
+}
+
 bool SWebInterface::HandleBeforePopup( FString URL, FString Frame )
 {
 #if UE_BUILD_DEVELOPMENT || UE_BUILD_DEBUG
@@ -364,6 +437,16 @@ float SWebInterface::GetTransparencyTick() const
 	return TransparencyTick;
 }
 
+bool SWebInterface::HasAdaptiveFrameRate() const
+{
+	return bAdaptiveFrameRate;
+}
+
+int32 SWebInterface::GetFrameRate() const
+{
+	return CurrentFrameRate;
+}
+
 int32 SWebInterface::GetTextureWidth() const
 {
 	if ( !BrowserWindow.IsValid() )
@@ -402,6 +485,27 @@ FColor SWebInterface::ReadTexturePixel( int32 X, int32 Y ) const
 	return FColor::Transparent;
 }
 
+bool SWebInterface::HitTestTexture( int32 X, int32 Y ) const
+{
+#if PLATFORM_ANDROID || PLATFORM_IOS
+	return ReadTexturePixel( X, Y ).A >= TransparencyThreshold * 255.0f;
+#else
+	if ( !BrowserWindow.IsValid() )
+		return false;
+
+	X = FMath::Clamp( X, 0, FMath::Max( GetTextureWidth()  - 1, 0 ) );
+	Y = FMath::Clamp( Y, 0, FMath::Max( GetTextureHeight() - 1, 0 ) );
+
+	// the coverage map is updated as each frame is painted, so this never waits on the render thread
+	bool bHit = true;
+	if ( BrowserWindow->HitTestPixel( X, Y, (uint8)FMath::Clamp( FMath::CeilToInt( TransparencyThreshold * 255.0f ), 0, 255 ), bHit ) )
+		return bHit;
+
+	// until the first frame has been mapped the page is treated as opaque
+	return true;
+#endif
+}
+
 TArray<FColor> SWebInterface::ReadTexturePixels( int32 X, int32 Y, int32 Width, int32 Height ) const
 {
 	TArray<FColor> OutPixels;
@@ -460,12 +564,14 @@ TArray<FColor> SWebInterface::ReadTexturePixels( int32 X, int32 Y, int32 Width,
 
 void SWebInterface::LoadURL( FString NewURL )
 {
+	FlushCalls( true );
 	if ( BrowserView.IsValid() )
 		BrowserView->LoadURL( NewURL );
 }
 
 void SWebInterface::LoadString( FString Contents, FString DummyURL )
 {
+	FlushCalls( true );
 	if ( BrowserView.IsValid() )
 		BrowserView->LoadString( Contents, DummyURL );
 }
@@ -508,10 +614,149 @@ bool SWebInterface::IsLoading() const
 
 void SWebInterface::ExecuteJavascript( const FString& ScriptText )
 {
+	// queued calls were made first, so they run first
+	FlushCalls( true );
+	ExecuteScript( ScriptText );
+}
+
+void SWebInterface::ExecuteScript( const FString& ScriptText )
+{
+	// scripts usually change the page, so paint it at the full frame rate right away
+	if ( HasAdaptiveFrameRate() )
+	{
+		IdleTime = 0.0f;
+		UpdateFrameRate( FrameRate );
+	}
+
 	if ( BrowserView.IsValid() )
 		BrowserView->ExecuteJavascript( ScriptText );
 }
 
+void SWebInterface::QueueCall( const FString& Function, const FJsonLibraryValue& Data, EWebInterfaceCallPolicy Policy )
+{
+	int32* Index = QueuedCallIndex.Find( Function );
+	if ( !Index )
+	{
+		FQueuedCall& NewCall = QueuedCalls.AddDefaulted_GetRef();
+		NewCall.Function = Function;
+		NewCall.Policy   = Policy;
+
+		Index = &QueuedCallIndex.Add( Function, QueuedCalls.Num() - 1 );
+	}
+
+	// switching policy starts over, so the newest call still wins
+	FQueuedCall& Call = QueuedCalls[ *Index ];
+	if ( Call.Policy != Policy )
+	{
+		Call.Text.Reset();
+		Call.Items.Reset();
+		Call.Value  = FJsonLibraryValue();
+		Call.Policy = Policy;
+	}
+
+	switch ( Policy )
+	{
+	case EWebInterfaceCallPolicy::Append:
+		if ( Data.GetType() == EJsonLibraryType::Array )
+		{
+			// keep the items of a list without its brackets, so every call joins one list
+			FString List = Data.Stringify();
+			List = List.Mid( 1, List.Len() - 2 ).TrimStartAndEnd();
+			if ( !List.IsEmpty() )
+				Call.Items.Add( List );
+		}
+		else if ( Data.GetType() != EJsonLibraryType::Invalid )
+			Call.Items.Add( Data.Stringify() );
+		break;
+
+	case EWebInterfaceCallPolicy::Merge:
+		if ( Call.Value.GetType() == EJsonLibraryType::Object && Data.GetType() == EJsonLibraryType::Object )
+		{
+			FJsonLibraryObject Object = Call.Value.GetObject();
+			Object.ApplyMergePatch( Data.GetObject() );
+		}
+		else if ( Data.GetType() != EJsonLibraryType::Invalid )
+			Call.Value = FJsonLibraryValue::Parse( Data.Stringify() );
+		break;
+
+	default:
+		Call.Text = Data.GetType() != EJsonLibraryType::Invalid ? Data.Stringify() : FString();
+		break;
+	}
+
+	// hidden widgets do not tick, and appended items must not pile up without limit
+	if ( FPlatformTime::Seconds() - LastTickTime > 0.25 || Call.Items.Num() >= 256 )
+		FlushCalls( true );
+}
+
+void SWebInterface::FlushCalls( bool bIgnoreRate /*= false*/ )
+{
+	if ( QueuedCalls.Num() == 0 )
+		return;
+
+	const double Now      = FPlatformTime::Seconds();
+	const double Interval = MaxCallRate > 0.0f ? 1.0 / MaxCallRate : 0.0;
+
+	FString Script;
+	TArray<FQueuedCall> HeldCalls;
+	for ( FQueuedCall& Call : QueuedCalls )
+	{
+		// a function over its rate keeps combining calls until it may be sent again
+		const double* LastSent = CallTimes.Find( Call.Function );
+		if ( !bIgnoreRate && LastSent && Now - *LastSent < Interval )
+		{
+			HeldCalls.Add( MoveTemp( Call ) );
+			continue;
+		}
+
+		FString Arguments;
+		if ( Call.Policy == EWebInterfaceCallPolicy::Append )
+			Arguments = TEXT( "[" ) + FString::Join( Call.Items, TEXT( "," ) ) + TEXT( "]" );
+		else if ( Call.Policy == EWebInterfaceCallPolicy::Merge )
+			Arguments = Call.Value.GetType() != EJsonLibraryType::Invalid ? Call.Value.Stringify() : FString();
+		else
+			Arguments = Call.Text;
+
+		Script += FString::Printf( TEXT( "try{i[%s](%s)}catch(e){console.error(e)}" ),
+			*FJsonLibraryValue( Call.Function ).Stringify(),
+			*Arguments );
+
+		if ( Interval > 0.0 )
+			CallTimes.Add( Call.Function, Now );
+	}
+
+	// sent functions leave the queue, so it only ever holds functions with calls pending
+	QueuedCalls = MoveTemp( HeldCalls );
+	QueuedCallIndex.Reset();
+	for ( int32 i = 0; i < QueuedCalls.Num(); i++ )
+		QueuedCallIndex.Add( QueuedCalls[ i ].Function, i );
+
+	for ( auto It = CallTimes.CreateIterator(); It; ++It )
+	{
+		if ( Now - It.Value() >= Interval )
+			It.RemoveCurrent();
+	}
+
+	if ( !Script.IsEmpty() )
+		ExecuteScript( FString::Printf( TEXT( "(function(i){%s})(ue.interface)" ), *Script ) );
+}
+
+void SWebInterface::PostData( const FString& Channel, const TArray<float>& Data )
+{
+#if !PLATFORM_ANDROID && !PLATFORM_IOS
+	if ( BrowserWindow.IsValid() )
+		BrowserWindow->PostData( Channel, Data.GetData(), Data.Num() );
+#endif
+}
+
+void SWebInterface::FlushData()
+{
+#if !PLATFORM_ANDROID && !PLATFORM_IOS
+	if ( BrowserWindow.IsValid() )
+		BrowserWindow->FlushData();
+#endif
+}
+
 void SWebInterface::BindUObject( const FString& Name, UObject* Object, bool bIsPermanent )
 {
 	if ( BrowserView.IsValid() )
@@ -43,6 +43,14 @@ UWebInterface::UWebInterface( const FObjectInitializer& ObjectInitializer )
 	Visibility  = ESlateVisibility::SelfHitTestInvisible;
 	FrameRate   = 60;
 
+	bCombineCalls = true;
+	MaxCallRate   = 0.0f;
+
+	bEnableAdaptiveFrameRate = false;
+	IdleFrameRate            = 5;
+	IdleFrameRateDelay       = 1.0f;
+	FrameTimeBudget          = 0.0f;
+
 	bEnableMouseTransparency   = false;
 	MouseTransparencyThreshold = 0.333f;
 	MouseTransparencyDelay     = 0.1f;
@@ -174,16 +182,22 @@ void UWebInterface::Execute( const FString& Script )
 #endif
 }
 
-void UWebInterface::Call( const FString& Function, const FJsonLibraryValue& Data )
+void UWebInterface::Call( const FString& Function, const FJsonLibraryValue& Data, EWebInterfaceCallPolicy Policy /*= EWebInterfaceCallPolicy::Replace*/ )
 {
 	// reserved
-	if ( Function == "broadcast" )
+	if ( Function == "broadcast" || Function == "send" )
 		return;
 
 #if !UE_SERVER
 	if ( !WebInterfaceWidget.IsValid() )
 		return;
 
+	if ( bCombineCalls )
+	{
+		WebInterfaceWidget->QueueCall( Function, Data, Policy );
+		return;
+	}
+
 	if ( Data.GetType() != EJsonLibraryType::Invalid )
 		WebInterfaceWidget->ExecuteJavascript( FString::Printf( TEXT( "ue.interface[%s](%s)" ),
 			*FJsonLibraryValue( Function ).Stringify(),
@@ -194,13 +208,29 @@ void UWebInterface::Call( const FString& Function, const FJsonLibraryValue& Data
 #endif
 }
 
+void UWebInterface::PostData( const FString& Channel, const TArray<float>& Data )
+{
+#if !UE_SERVER
+	if ( WebInterfaceWidget.IsValid() )
+		WebInterfaceWidget->PostData( Channel, Data );
+#endif
+}
+
+void UWebInterface::FlushData()
+{
+#if !UE_SERVER
+	if ( WebInterfaceWidget.IsValid() )
+		WebInterfaceWidget->FlushData();
+#endif
+}
+
 void UWebInterface::Bind( const FString& Name, UObject* Object )
 {
 	if ( !Object )
 		return;
 
 	// reserved
-	if ( Name.ToLower() == "interface" )
+	if ( Name.ToLower() == "interface" || Name.ToLower() == "data" )
 		return;
 	
 #if !UE_SERVER
@@ -215,7 +245,7 @@ void UWebInterface::Unbind( const FString& Name, UObject* Object )
 		return;
 
 	// reserved
-	if ( Name.ToLower() == "interface" )
+	if ( Name.ToLower() == "interface" || Name.ToLower() == "data" )
 		return;
 	
 #if !UE_SERVER
@@ -444,6 +474,15 @@ FColor UWebInterface::ReadTexturePixel( int32 X, int32 Y )
 	return FColor::Transparent;
 }
 
+bool UWebInterface::HitTestTexture( int32 X, int32 Y )
+{
+#if !UE_SERVER
+	if ( WebInterfaceWidget.IsValid() )
+		return WebInterfaceWidget->HitTestTexture( X, Y );
+#endif
+	return false;
+}
+
 TArray<FColor> UWebInterface::ReadTexturePixels( int32 X, int32 Y, int32 Width, int32 Height )
 {
 #if !UE_SERVER
@@ -475,6 +514,11 @@ TSharedRef<SWidget> UWebInterface::RebuildWidget()
 
 	WebInterfaceWidget = SNew( SWebInterface )
 		.FrameRate( FrameRate )
+		.MaxCallRate( MaxCallRate )
+		.EnableAdaptiveFrameRate( bEnableAdaptiveFrameRate )
+		.IdleFrameRate( IdleFrameRate )
+		.IdleDelay( IdleFrameRateDelay )
+		.FrameTimeBudget( FrameTimeBudget )
 		.InitialURL( InitialURL )
 		.NativeCursors( !bCustomCursors )
 		.EnableMouseTransparency( bEnableMouseTransparency )
@@ -176,8 +176,7 @@ UWebInterfaceInteractionComponent::FWidgetTraceResult UWebInterfaceInteractionCo
 									const int32 X = (int32)( Location.X * WebInterface->GetTextureWidth() );
 									const int32 Y = (int32)( Location.Y * WebInterface->GetTextureHeight() );
 
-									const FLinearColor Pixel = WebInterface->ReadTexturePixel( X, Y );
-									if ( Pixel.A >= WebInterface->GetTransparencyThreshold() )
+									if ( WebInterface->HitTestTexture( X, Y ) )
 										bHit = true;
 								}
 								else
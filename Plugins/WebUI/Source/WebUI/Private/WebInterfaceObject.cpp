@@ -13,3 +13,21 @@ void UWebInterfaceObject::Broadcast( const FString& Name, const FString& Data, c
 	else
 		MyInterface->OnInterfaceEvent.Broadcast( FName( *Name ), FJsonLibraryValue::Parse( Data ), FWebInterfaceCallback( MyInterface, Callback ) );
 }
+
+int32 UWebInterfaceObject::Dispatch( const TArray<FString>& Names, const TArray<FString>& Data, const TArray<FString>& Callbacks, const TArray<FString>& Channels, const TArray<int32>& Counts, const TArray<float>& Values )
+{
+	int32 Dispatched = 0;
+	for ( int32 i = 0; i < Names.Num() && MyInterface.IsValid(); i++, Dispatched++ )
+		Broadcast( Names[ i ], Data.IsValidIndex( i ) ? Data[ i ] : FString(), Callbacks.IsValidIndex( i ) ? Callbacks[ i ] : FString() );
+
+	// the number arrays of every channel are packed one after another
+	int32 Offset = 0;
+	for ( int32 i = 0; i < Channels.Num() && i < Counts.Num() && MyInterface.IsValid(); i++, Dispatched++ )
+	{
+		const int32 Count = FMath::Clamp( Counts[ i ], 0, Values.Num() - Offset );
+		MyInterface->OnInterfaceData.Broadcast( FName( *Channels[ i ] ), TArray<float>( Values.GetData() + Offset, Count ) );
+		Offset += Count;
+	}
+
+	return Dispatched;
+}
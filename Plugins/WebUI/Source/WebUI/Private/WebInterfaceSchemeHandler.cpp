@@ -3,8 +3,157 @@
 #if !UE_SERVER && WITH_CEF3
 #include "GenericPlatform/GenericPlatformHttp.h"
 #include "HAL/FileManager.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
 
 #define BIN "application/octet-stream"
+
+static FString GetAssetMimeType( const FString& FilePath )
+{
+	FString MimeType = FGenericPlatformHttp::GetMimeType( FilePath );
+	if ( MimeType.Len() == 0 || MimeType == "application/unknown" )
+		MimeType = BIN;
+
+	return MimeType;
+}
+
+FWebInterfaceAssetCache& FWebInterfaceAssetCache::Get()
+{
+	static FWebInterfaceAssetCache Cache;
+	return Cache;
+}
+
+FWebInterfaceAssetCache::FWebInterfaceAssetCache()
+	: TotalSize( 0 )
+	, MaxSize( 0 )
+	, UseCount( 0 )
+	, bValidate( true )
+{
+	int32 CacheSize = 32;
+	if ( GConfig )
+	{
+		GConfig->GetInt( TEXT( "WebUI" ), TEXT( "AssetCacheSize" ), CacheSize, GEngineIni );
+		GConfig->GetBool( TEXT( "WebUI" ), TEXT( "bValidateAssetCache" ), bValidate, GEngineIni );
+	}
+
+	// the size is configured in megabytes
+	MaxSize = (int64)FMath::Max( 0, CacheSize ) * 1024 * 1024;
+}
+
+FWebInterfaceAssetPtr FWebInterfaceAssetCache::Find( const FString& FilePath )
+{
+	if ( MaxSize <= 0 )
+		return nullptr;
+
+	// stat the file outside of the lock so other requests are not held up
+	const FDateTime TimeStamp = bValidate ? IFileManager::Get().GetTimeStamp( *FilePath ) : FDateTime::MinValue();
+	{
+		FScopeLock ScopeLock( &Lock );
+		if ( FEntry* Entry = Entries.Find( FilePath ) )
+		{
+			if ( !bValidate || Entry->Asset->TimeStamp == TimeStamp )
+			{
+				Entry->LastUsed = ++UseCount;
+				return Entry->Asset;
+			}
+
+			TotalSize -= Entry->Asset->Data.Num();
+			Entries.Remove( FilePath );
+		}
+	}
+
+	if ( bValidate && TimeStamp == FDateTime::MinValue() )
+		return nullptr;
+
+	return Load( FilePath, TimeStamp );
+}
+
+void FWebInterfaceAssetCache::Preload( const FString& Directory )
+{
+	if ( MaxSize <= 0 )
+		return;
+
+	TArray<FString> Files;
+	IFileManager::Get().FindFilesRecursive( Files, *Directory, TEXT( "*" ), true, false );
+
+	for ( FString& File : Files )
+	{
+		File = File.Replace( TEXT( "\\" ), TEXT( "/" ) );
+		File = File.Replace( TEXT( "//" ), TEXT( "/" ) );
+
+		const int64 FileSize = IFileManager::Get().FileSize( *File );
+		if ( FileSize > MaxSize / 4 )
+			continue;
+
+		// stop once the cache is full rather than evicting files loaded earlier
+		{
+			FScopeLock ScopeLock( &Lock );
+			if ( TotalSize + FileSize > MaxSize )
+				break;
+		}
+
+		Load( File, IFileManager::Get().GetTimeStamp( *File ) );
+	}
+}
+
+void FWebInterfaceAssetCache::Empty()
+{
+	FScopeLock ScopeLock( &Lock );
+	Entries.Empty();
+	TotalSize = 0;
+}
+
+FWebInterfaceAssetPtr FWebInterfaceAssetCache::Load( const FString& FilePath, const FDateTime& TimeStamp )
+{
+	// files that would take up most of the cache are streamed from disk instead
+	const int64 FileSize = IFileManager::Get().FileSize( *FilePath );
+	if ( FileSize == INDEX_NONE || FileSize > MaxSize / 4 || FileSize > INT32_MAX )
+		return nullptr;
+
+	TSharedPtr<FWebInterfaceAsset, ESPMode::ThreadSafe> NewAsset = MakeShared<FWebInterfaceAsset, ESPMode::ThreadSafe>();
+	if ( !FFileHelper::LoadFileToArray( NewAsset->Data, *FilePath, FILEREAD_Silent ) )
+		return nullptr;
+
+	NewAsset->MimeType  = GetAssetMimeType( FilePath );
+	NewAsset->TimeStamp = TimeStamp;
+
+	FScopeLock ScopeLock( &Lock );
+	if ( FEntry* Entry = Entries.Find( FilePath ) )
+		TotalSize -= Entry->Asset->Data.Num();
+
+	FEntry& NewEntry = Entries.Add( FilePath );
+	NewEntry.Asset    = NewAsset;
+	NewEntry.LastUsed = ++UseCount;
+
+	TotalSize += NewAsset->Data.Num();
+	Trim();
+
+	return NewAsset;
+}
+
+void FWebInterfaceAssetCache::Trim()
+{
+	// the cache holds a few hundred files at most, so a linear search is cheap enough
+	while ( TotalSize > MaxSize && Entries.Num() > 1 )
+	{
+		FString OldestPath;
+		uint64 OldestUse = MAX_uint64;
+
+		for ( const TPair<FString, FEntry>& Pair : Entries )
+		{
+			if ( Pair.Value.LastUsed < OldestUse )
+			{
+				OldestPath = Pair.Key;
+				OldestUse  = Pair.Value.LastUsed;
+			}
+		}
+
+		TotalSize -= Entries[ OldestPath ].Asset->Data.Num();
+		Entries.Remove( OldestPath );
+	}
+}
+
 FWebInterfaceSchemeHandler::FWebInterfaceSchemeHandler()
 	: MimeType( BIN )
 	, ContentLength( 0 )
@@ -42,6 +191,16 @@ bool FWebInterfaceSchemeHandler::ProcessRequest( const FString& Verb, const FStr
 	FilePath = FilePath.Replace( TEXT( "\\" ), TEXT( "/" ) );
 	FilePath = FilePath.Replace( TEXT( "//" ), TEXT( "/" ) );
 
+	Asset = FWebInterfaceAssetCache::Get().Find( FilePath );
+	if ( Asset.IsValid() )
+	{
+		ContentLength = Asset->Data.Num();
+		MimeType      = Asset->MimeType;
+
+		OnHeadersReady.Execute();
+		return true;
+	}
+
 	const int64 FileSize = IFileManager::Get().FileSize( *FilePath );
 	if ( FileSize != INDEX_NONE )
 	{
@@ -49,10 +208,7 @@ bool FWebInterfaceSchemeHandler::ProcessRequest( const FString& Verb, const FStr
 		if ( FileSize > INT32_MAX )
 			return false;
 	
-		MimeType = FGenericPlatformHttp::GetMimeType( FilePath );
-		if ( MimeType.Len() == 0 || MimeType == "application/unknown" )
-			MimeType = BIN;
-
+		MimeType = GetAssetMimeType( FilePath );
 		CreateReader( *FilePath );
 	}
 	
@@ -62,7 +218,7 @@ bool FWebInterfaceSchemeHandler::ProcessRequest( const FString& Verb, const FStr
 
 void FWebInterfaceSchemeHandler::GetResponseHeaders( IHeaders& OutHeaders )
 {
-	if ( Reader )
+	if ( Reader || Asset.IsValid() )
 	{
 		OutHeaders.SetStatusCode( 200 );
 		OutHeaders.SetMimeType( *MimeType );
@@ -75,7 +231,7 @@ void FWebInterfaceSchemeHandler::GetResponseHeaders( IHeaders& OutHeaders )
 bool FWebInterfaceSchemeHandler::ReadResponse( uint8* OutBytes, int32 BytesToRead, int32& BytesRead, const FSimpleDelegate& OnMoreDataReady )
 {
 	BytesRead = 0;
-	if ( !Reader )
+	if ( !Reader && !Asset.IsValid() )
 		return false;
 
 	BytesRead = ContentLength - TotalBytesRead;
@@ -85,13 +241,21 @@ bool FWebInterfaceSchemeHandler::ReadResponse( uint8* OutBytes, int32 BytesToRea
 	if ( BytesRead > BytesToRead )
 		BytesRead = BytesToRead;
 
-	Reader->Serialize( OutBytes, BytesRead );
+	// cached files are copied straight from the shared buffer
+	if ( Asset.IsValid() )
+		FMemory::Memcpy( OutBytes, Asset->Data.GetData() + TotalBytesRead, BytesRead );
+	else
+		Reader->Serialize( OutBytes, BytesRead );
+
 	TotalBytesRead += BytesRead;
 
 	if ( TotalBytesRead < ContentLength )
 		OnMoreDataReady.Execute();
 	else
+	{
+		Asset.Reset();
 		CloseReader();
+	}
 	
 	return true;
 }
@@ -101,6 +265,7 @@ void FWebInterfaceSchemeHandler::Cancel()
 	ContentLength  = 0;
 	TotalBytesRead = 0;
 
+	Asset.Reset();
 	CloseReader();
 }
 
@@ -1,18 +1,28 @@
 // Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
 #include "WebUIModule.h"
 #include "Modules/ModuleManager.h"
+#include "WebInterfaceSchemeHandler.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Paths.h"
 
 class FWebUIModule : public IWebUIModule
 {
 public:
 	virtual void StartupModule() override
 	{
-		//
+#if !UE_SERVER && WITH_CEF3
+		// optionally load a content directory served through the pak scheme up front
+		FString PreloadDirectory;
+		if ( GConfig && GConfig->GetString( TEXT( "WebUI" ), TEXT( "AssetCachePreload" ), PreloadDirectory, GEngineIni ) && !PreloadDirectory.IsEmpty() )
+			FWebInterfaceAssetCache::Get().Preload( FPaths::ProjectContentDir() + PreloadDirectory );
+#endif
 	}
 
 	virtual void ShutdownModule() override
 	{
-		//
+#if !UE_SERVER && WITH_CEF3
+		FWebInterfaceAssetCache::Get().Empty();
+#endif
 	}
 };
 
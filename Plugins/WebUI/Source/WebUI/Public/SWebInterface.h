@@ -1,6 +1,7 @@
 // Copyright 2021 Tracer Interactive, LLC. All Rights Reserved.
 #pragma once
 #include "CoreMinimal.h"
+#include "JsonLibrary.h"
 #include "Engine/Texture.h"
 #include "Layout/Visibility.h"
 #include "Widgets/DeclarativeSyntaxSupport.h"
@@ -34,6 +35,22 @@ class IWebInterfaceBrowserPopupFeatures;
 enum class EWebInterfaceBrowserDialogEventResponse;
 #endif
 struct FWebNavigationRequest;
+enum class EWebInterfaceCallPolicy : uint8;
+
+// JavaScript function names are case-sensitive.
+template<typename ValueType>
+struct FWebInterfaceCallKeyFuncs : TDefaultMapKeyFuncs<FString, ValueType, false>
+{
+	static bool Matches( const FString& A, const FString& B )
+	{
+		return A.Equals( B, ESearchCase::CaseSensitive );
+	}
+
+	static uint32 GetKeyHash( const FString& Key )
+	{
+		return FCrc::StrCrc32( *Key );
+	}
+};
 
 class WEBUI_API SWebInterface : public SCompoundWidget
 {
@@ -46,6 +63,11 @@ public:
 
 	SLATE_BEGIN_ARGS( SWebInterface )
 		: _FrameRate( 60 )
+		, _EnableAdaptiveFrameRate( false )
+		, _IdleFrameRate( 5 )
+		, _IdleDelay( 1.0f )
+		, _FrameTimeBudget( 0.0f )
+		, _MaxCallRate( 0.0f )
 		, _InitialURL( TEXT( "http://tracerinteractive.com" ) )
 		, _BackgroundColor( 255, 255, 255, 255 )
 		, _EnableMouseTransparency( false )
@@ -59,6 +81,11 @@ public:
 	}
 		SLATE_ARGUMENT( TSharedPtr<SWindow>, ParentWindow )
 		SLATE_ARGUMENT( int32, FrameRate )
+		SLATE_ARGUMENT( bool, EnableAdaptiveFrameRate )
+		SLATE_ARGUMENT( int32, IdleFrameRate )
+		SLATE_ARGUMENT( float, IdleDelay )
+		SLATE_ARGUMENT( float, FrameTimeBudget )
+		SLATE_ARGUMENT( float, MaxCallRate )
 		SLATE_ARGUMENT( FString, InitialURL )
 		SLATE_ARGUMENT( TOptional<FString>, ContentsToLoad )
 		SLATE_ARGUMENT( FColor, BackgroundColor )
@@ -101,8 +128,32 @@ private:
 	float        LastMouseTime;
 	float        LastMouseTick;
 
+	int32 CurrentFrameRate;
+	float IdleTime;
+	float AverageDeltaTime;
+
+	struct FQueuedCall
+	{
+		FString Function;
+		FString Text;
+		TArray<FString> Items;
+		FJsonLibraryValue Value;
+		EWebInterfaceCallPolicy Policy;
+	};
+
+	// Pending calls, in the order each function was first called since it was last sent.
+	TArray<FQueuedCall> QueuedCalls;
+	TMap<FString, int32, FDefaultSetAllocator, FWebInterfaceCallKeyFuncs<int32>> QueuedCallIndex;
+	// Send times of functions that are still held back by the call rate.
+	TMap<FString, double, FDefaultSetAllocator, FWebInterfaceCallKeyFuncs<double>> CallTimes;
+	double LastTickTime;
+
 	EVisibility GetViewportVisibility() const;
 
+	void UpdateFrameRate( int32 NewFrameRate );
+	void ExecuteScript( const FString& ScriptText );
+	void HandleNeedsRedraw();
+
 	bool HandleBeforePopup( FString URL, FString Frame );
 	bool HandleSuppressContextMenu();
 
@@ -127,6 +178,13 @@ protected:
 	float TransparencyThreshold;
 	float TransparencyTick;
 
+	bool  bAdaptiveFrameRate;
+	int32 FrameRate;
+	int32 IdleFrameRate;
+	float IdleDelay;
+	float FrameTimeBudget;
+
+	float MaxCallRate;
 
 	FSimpleDelegate OnLoadCompleted;
 	FSimpleDelegate OnLoadError;
@@ -154,10 +212,14 @@ public:
 	float GetTransparencyThreshold() const;
 	float GetTransparencyTick() const;
 
+	bool HasAdaptiveFrameRate() const;
+	int32 GetFrameRate() const;
+
 	int32 GetTextureWidth() const;
 	int32 GetTextureHeight() const;
 
 	FColor ReadTexturePixel( int32 X, int32 Y ) const;
+	bool HitTestTexture( int32 X, int32 Y ) const;
 	TArray<FColor> ReadTexturePixels( int32 X, int32 Y, int32 Width, int32 Height ) const;
 	
 	void LoadURL( FString NewURL );
@@ -173,6 +235,12 @@ public:
 
 	void ExecuteJavascript( const FString& ScriptText );
 
+	void QueueCall( const FString& Function, const FJsonLibraryValue& Data, EWebInterfaceCallPolicy Policy );
+	void FlushCalls( bool bIgnoreRate = false );
+
+	void PostData( const FString& Channel, const TArray<float>& Data );
+	void FlushData();
+
 	void BindUObject( const FString& Name, UObject* Object, bool bIsPermanent = true );
 	void UnbindUObject( const FString& Name, UObject* Object, bool bIsPermanent = true );
 
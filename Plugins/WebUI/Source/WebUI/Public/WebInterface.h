@@ -15,6 +15,14 @@ enum class EWebInterfaceDirectory : uint8
 	Content	UMETA(DisplayName="/Content")
 };
 
+UENUM(BlueprintType, meta = (DisplayName = "UI Call Policy"))
+enum class EWebInterfaceCallPolicy : uint8
+{
+	Replace	UMETA(DisplayName="Replace"),
+	Append	UMETA(DisplayName="Append"),
+	Merge	UMETA(DisplayName="Merge")
+};
+
 UCLASS()
 class WEBUI_API UWebInterface : public UWidget
 {
@@ -25,6 +33,7 @@ public:
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam( FOnUrlChangedEvent, const FText&, URL );
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams( FOnPopupEvent, const FString&, URL, const FString&, Frame );
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams( FOnInterfaceEvent, const FName, Name, FJsonLibraryValue, Data, FWebInterfaceCallback, Callback );
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams( FOnInterfaceData, const FName, Name, const TArray<float>&, Data );
 
 	// Load the browser.
 	UFUNCTION(BlueprintCallable, Category = "Web UI")
@@ -49,9 +58,17 @@ public:
 	// Execute JavaScript in the browser context.
 	UFUNCTION(BlueprintCallable, Category = "Web UI")
 	void Execute( const FString& Script );
-	// Call ue.interface.function(data) in the browser context.
-	UFUNCTION(BlueprintCallable, Category = "Web UI", meta = (AdvancedDisplay = "Data", AutoCreateRefTerm = "Data"))
-	void Call( const FString& Function, const FJsonLibraryValue& Data );
+	// Call ue.interface.function(data) in the browser context; calls to the same function are combined until the end of the frame.
+	// Combined functions run in the order each was first called that frame, so a function called again runs at its first place.
+	UFUNCTION(BlueprintCallable, Category = "Web UI", meta = (AdvancedDisplay = "Data,Policy", AutoCreateRefTerm = "Data"))
+	void Call( const FString& Function, const FJsonLibraryValue& Data, EWebInterfaceCallPolicy Policy = EWebInterfaceCallPolicy::Replace );
+
+	// Queue numbers for ue.data.subscribe(function(batch) {}) in the browser context, sent once per frame without compiling any script.
+	UFUNCTION(BlueprintCallable, Category = "Web UI|Data")
+	void PostData( const FString& Channel, const TArray<float>& Data );
+	// Send the numbers queued for the browser context now, instead of at the end of the frame.
+	UFUNCTION(BlueprintCallable, Category = "Web UI|Data")
+	void FlushData();
 	
 	// Bind an object to ue.name in the browser context.
 	UFUNCTION(BlueprintCallable, Category = "Web UI")
@@ -104,6 +121,9 @@ public:
 	// Read a pixel from the browser texture.
 	UFUNCTION(BlueprintCallable, Category = "Web UI|Textures")
 	FColor ReadTexturePixel( int32 X, int32 Y );
+	// Check if a pixel of the last painted frame reaches the transparency threshold, without waiting on the render thread.
+	UFUNCTION(BlueprintCallable, Category = "Web UI|Textures")
+	bool HitTestTexture( int32 X, int32 Y );
 	// Read an area of pixels from the browser texture.
 	UFUNCTION(BlueprintCallable, Category = "Web UI|Textures")
 	TArray<FColor> ReadTexturePixels( int32 X, int32 Y, int32 Width, int32 Height );
@@ -118,6 +138,10 @@ public:
 	// Called with ue.interface.broadcast(name, data) in the browser context.
 	UPROPERTY(BlueprintAssignable, Category = "Web UI|Events")
 	FOnInterfaceEvent OnInterfaceEvent;
+	// Called with ue.interface.send(name, numbers) in the browser context.
+	// Pages without the bound interface object fall back to the URL hash, where send is a broadcast that raises On Interface Event instead.
+	UPROPERTY(BlueprintAssignable, Category = "Web UI|Events")
+	FOnInterfaceData OnInterfaceData;
 
 	virtual void ReleaseSlateResources( bool bReleaseChildren ) override;
 
@@ -142,6 +166,22 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Behavior")
 	FString InitialURL;
 
+	// Send the calls made in a frame as one script when the widget ticks.
+	// Execute, Load URL and hidden widgets send pending calls first, so calls still run in order with scripts.
+	UPROPERTY(EditAnywhere, meta = (DisplayName = "Combine Calls"), Category = "Behavior|Calls")
+	bool bCombineCalls;
+	UPROPERTY(EditAnywhere, meta = (DisplayName = "Max Calls Per Second", UIMin = 0, UIMax = 60), Category = "Behavior|Calls")
+	float MaxCallRate;
+
+	UPROPERTY(EditAnywhere, meta = (DisplayName = "Enable Adaptive"), Category = "Behavior|Frame Rate")
+	bool bEnableAdaptiveFrameRate;
+	UPROPERTY(EditAnywhere, meta = (DisplayName = "Idle Frame Rate", UIMin = 1, UIMax = 60), Category = "Behavior|Frame Rate")
+	int32 IdleFrameRate;
+	UPROPERTY(EditAnywhere, meta = (DisplayName = "Idle Delay", UIMin = 0, UIMax = 10), Category = "Behavior|Frame Rate")
+	float IdleFrameRateDelay;
+	UPROPERTY(EditAnywhere, meta = (DisplayName = "Frame Time Budget (ms)", UIMin = 0, UIMax = 100), Category = "Behavior|Frame Rate")
+	float FrameTimeBudget;
+
 	UPROPERTY(EditAnywhere, meta = (DisplayName = "Enable Transparency"), Category = "Behavior|Mouse")
 	bool bEnableMouseTransparency;
 	UPROPERTY(EditAnywhere, meta = (DisplayName = "Transparency Threshold", UIMin = 0, UIMax = 1), Category = "Behavior|Mouse")
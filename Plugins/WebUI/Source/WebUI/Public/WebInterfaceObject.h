@@ -17,6 +17,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Web UI")
 	void Broadcast( const FString& Name, const FString& Data, const FString& Callback );
 
+	// Receive a batch of events and number arrays in one message; the page waits for this to return before it sends the next batch.
+	UFUNCTION(BlueprintCallable, Category = "Web UI")
+	int32 Dispatch( const TArray<FString>& Names, const TArray<FString>& Data, const TArray<FString>& Callbacks, const TArray<FString>& Channels, const TArray<int32>& Counts, const TArray<float>& Values );
+
 private:
 
 	TWeakObjectPtr<UWebInterface> MyInterface;
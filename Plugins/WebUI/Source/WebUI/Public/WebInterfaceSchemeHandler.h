@@ -2,6 +2,65 @@
 #pragma once
 #if !UE_SERVER && WITH_CEF3
 #include "IWebInterfaceBrowserSchemeHandler.h"
+#include "Misc/DateTime.h"
+#include "HAL/CriticalSection.h"
+
+struct FWebInterfaceAsset
+{
+	TArray<uint8> Data;
+	FString MimeType;
+	FDateTime TimeStamp;
+};
+
+typedef TSharedPtr<const FWebInterfaceAsset, ESPMode::ThreadSafe> FWebInterfaceAssetPtr;
+
+// least recently used cache of files served through the pak scheme
+class WEBUI_API FWebInterfaceAssetCache
+{
+public:
+	static FWebInterfaceAssetCache& Get();
+
+	// returns the cached file, loading it if needed, or null if it is missing or too large to cache
+	FWebInterfaceAssetPtr Find( const FString& FilePath );
+
+	// loads every file in the directory until the cache is full
+	void Preload( const FString& Directory );
+	void Empty();
+
+private:
+	FWebInterfaceAssetCache();
+
+	struct FEntry
+	{
+		FWebInterfaceAssetPtr Asset;
+		uint64 LastUsed;
+	};
+
+	// paths are matched case-sensitively, so files differing only in case never share an entry on case-sensitive file systems
+	struct FEntryKeyFuncs : TDefaultMapKeyFuncs<FString, FEntry, false>
+	{
+		static bool Matches( const FString& A, const FString& B )
+		{
+			return A.Equals( B, ESearchCase::CaseSensitive );
+		}
+
+		static uint32 GetKeyHash( const FString& Key )
+		{
+			return FCrc::StrCrc32( *Key );
+		}
+	};
+
+	FCriticalSection Lock;
+	TMap<FString, FEntry, FDefaultSetAllocator, FEntryKeyFuncs> Entries;
+
+	int64  TotalSize;
+	int64  MaxSize;
+	uint64 UseCount;
+	bool   bValidate;
+
+	FWebInterfaceAssetPtr Load( const FString& FilePath, const FDateTime& TimeStamp );
+	void Trim();
+};
 
 class WEBUI_API FWebInterfaceSchemeHandler : public IWebInterfaceBrowserSchemeHandler
 {
@@ -21,6 +80,7 @@ protected:
 	int32 TotalBytesRead;
 
 	FArchive* Reader;
+	FWebInterfaceAssetPtr Asset;
 
 	void CreateReader( const FString& FilePath );
 	void CloseReader();